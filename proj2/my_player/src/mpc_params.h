@@ -0,0 +1,70 @@
+/* Generated by fit_mpc from 200 games with seed 1, do not edit. */
+#ifndef MPC_PARAMS_H
+#define MPC_PARAMS_H
+
+/* board size the parameters were fitted on, game phases and deep depths */
+#define MPC_BOARD_SIZE 8
+#define MPC_PHASES 4
+#define MPC_MIN_DEPTH 3
+#define MPC_MAX_DEPTH 8
+
+/*
+ * Fit of a deep search score against the score of a shallow search of the
+ * same position: deep = slope * shallow + offset, missing by sigma on
+ * average. A zero slope means there is no fit.
+ */
+typedef struct {
+    int shallow;
+    double slope;
+    double offset;
+    double sigma;
+} MpcParams;
+
+static const MpcParams MPC_PARAMS[MPC_PHASES][MPC_MAX_DEPTH + 1] = {
+    {
+        {0, 0.0000, 0.00, 0.00}, /* depth 0, 0 samples */
+        {0, 0.0000, 0.00, 0.00}, /* depth 1, 0 samples */
+        {0, 0.0000, 0.00, 0.00}, /* depth 2, 0 samples */
+        {1, 0.9095, -0.91, 11.31}, /* depth 3, 600 samples */
+        {2, 0.9086, 0.82, 9.82}, /* depth 4, 600 samples */
+        {1, 0.9926, -0.98, 16.14}, /* depth 5, 600 samples */
+        {2, 0.8378, 1.24, 11.18}, /* depth 6, 600 samples */
+        {3, 0.9915, 0.66, 10.92}, /* depth 7, 600 samples */
+        {4, 0.9815, 1.07, 10.00}, /* depth 8, 600 samples */
+    },
+    {
+        {0, 0.0000, 0.00, 0.00}, /* depth 0, 0 samples */
+        {0, 0.0000, 0.00, 0.00}, /* depth 1, 0 samples */
+        {0, 0.0000, 0.00, 0.00}, /* depth 2, 0 samples */
+        {1, 1.1396, -3.36, 14.10}, /* depth 3, 1000 samples */
+        {2, 1.1168, 1.20, 11.86}, /* depth 4, 1000 samples */
+        {1, 1.2662, -4.06, 20.77}, /* depth 5, 1000 samples */
+        {2, 1.2250, 2.46, 18.06}, /* depth 6, 1000 samples */
+        {3, 1.2291, -0.06, 15.92}, /* depth 7, 1000 samples */
+        {4, 1.2122, 2.38, 14.76}, /* depth 8, 1000 samples */
+    },
+    {
+        {0, 0.0000, 0.00, 0.00}, /* depth 0, 0 samples */
+        {0, 0.0000, 0.00, 0.00}, /* depth 1, 0 samples */
+        {0, 0.0000, 0.00, 0.00}, /* depth 2, 0 samples */
+        {1, 1.0280, -1.31, 23.52}, /* depth 3, 981 samples */
+        {2, 1.0163, -0.09, 22.93}, /* depth 4, 981 samples */
+        {1, 1.1160, -2.30, 30.91}, /* depth 5, 981 samples */
+        {2, 1.0517, 0.28, 30.76}, /* depth 6, 981 samples */
+        {3, 1.1006, 0.83, 27.45}, /* depth 7, 981 samples */
+        {4, 1.0998, 1.19, 27.97}, /* depth 8, 981 samples */
+    },
+    {
+        {0, 0.0000, 0.00, 0.00}, /* depth 0, 0 samples */
+        {0, 0.0000, 0.00, 0.00}, /* depth 1, 0 samples */
+        {0, 0.0000, 0.00, 0.00}, /* depth 2, 0 samples */
+        {1, 1.0946, -2.88, 18.37}, /* depth 3, 387 samples */
+        {2, 1.0852, 0.77, 17.28}, /* depth 4, 387 samples */
+        {1, 1.1775, -4.54, 34.25}, /* depth 5, 387 samples */
+        {2, 1.1630, 1.65, 32.92}, /* depth 6, 387 samples */
+        {3, 1.1565, -0.26, 33.93}, /* depth 7, 387 samples */
+        {4, 1.1474, 3.83, 34.65}, /* depth 8, 387 samples */
+    },
+};
+
+#endif
@@ -34,6 +34,8 @@
  *
  ************************************************************************/
 #include "comms.h"
+#include "mpc_params.h"
+#include "othello.h"
 #include <arpa/inet.h>
 #include <mpi.h>
 #include <stdbool.h>
@@ -42,66 +44,283 @@
 #include <string.h>
 #include <time.h>
 
-#define BOARD_SIZE 8
 #define EMPTY 0
 #define BLACK 1
 #define WHITE 2
 
-#define MAX_MOVES 64
+/* frames of the search stack, so the deepest the search goes; iterative
+   deepening stops at it or at the end of the game, whichever comes first */
+#define MAX_PLY 64
+
+/* transposition table size for every process, in megabytes, unless set on
+   the command line or in the environment */
+#define TT_MEGABYTES 64
+#define TT_MEGABYTES_ENV "OTHELLO_TT_MB"
+
+/* search algorithms, chosen at startup with OTHELLO_SEARCH */
+#define SEARCH_ALPHABETA 0
+#define SEARCH_PVS 1
+#define SEARCH_MTDF 2
+#define SEARCH_MODE_ENV "OTHELLO_SEARCH"
+
+/* root window bounds, and the default aspiration window around the previous
+   depth's score: its half-width and how much it grows when a search falls
+   outside it */
+#define SCORE_INFINITY 999999
+#define ASPIRATION_WIDTH 32
+#define ASPIRATION_GROWTH 4
+#define ASPIRATION_WIDTH_ENV "OTHELLO_ASPIRATION"
+#define ASPIRATION_GROWTH_ENV "OTHELLO_ASPIRATION_GROWTH"
+
+/* time limit, in seconds, of a search that is not to be cut short */
+#define NO_TIME_LIMIT 1e9
+
+/* positions with this many empty squares or fewer are solved exactly, unless
+   set in the environment; a root search with SOLVE_DEPTH solves the game */
+#define ENDGAME_EMPTIES 20
+#define ENDGAME_EMPTIES_ENV "OTHELLO_ENDGAME_EMPTIES"
+#define SOLVE_DEPTH (BOARD_SQUARES + 1)
+
+/* a worker left without a root move tries to prove a win for positions with
+   more empty squares than the endgame solver takes, up to this many, holding
+   at most PROOF_NODES tree nodes; both can be set in the environment */
+#define PROOF_EMPTIES 28
+#define PROOF_EMPTIES_ENV "OTHELLO_PROOF_EMPTIES"
+#define PROOF_NODES 1000000
+#define PROOF_NODES_ENV "OTHELLO_PROOF_NODES"
+
+/* worker command that starts a proof-number search instead of root moves */
+#define PROVE_COMMAND 2
+
+/* a worker searching root moves or pondering looks for the master's stop
+   every STOP_POLL_INTERVAL time checks */
+#define STOP_POLL_INTERVAL 4096
+
+/* while the opponent thinks, workers ponder its likeliest replies, ranked by
+   a search this deep, unless turned off in the environment */
+#define PONDER_COMMAND 3
+#define PONDER_GUESS_DEPTH 4
+#define PONDER_ENV "OTHELLO_PONDER"
+
+/* reply to stop pondering with when the opponent has not replied */
+#define PONDER_CANCELLED -2
+
+/* opening book the master maps at startup, unless named in the environment;
+   a missing book is no error */
+#define BOOK_FILE "opening.book"
+#define BOOK_FILE_ENV "OTHELLO_BOOK"
+
+/* Multi-ProbCut cuts a node when a shallow search puts the deep score this
+   many standard deviations past the window, unless set in the environment;
+   the fitted parameters in mpc_params.h only hold for the board they were
+   fitted on */
+#define MPC_THRESHOLD 1.5
+#define MPC_THRESHOLD_ENV "OTHELLO_MPC"
+#define MPC_FITTED (BOARD_SIZE == MPC_BOARD_SIZE)
+
+/* late move reductions: from LMR_DEPTH plies from the leaves, the moves
+   after the first LMR_MOVES are searched a ply shallower, and a ply
+   shallower again for every LMR_STEP plies of depth and moves further down
+   the list both; all three can be set in the environment */
+#define LMR_DEPTH 4
+#define LMR_MOVES 4
+#define LMR_STEP 3
+#define LMR_DEPTH_ENV "OTHELLO_LMR_DEPTH"
+#define LMR_MOVES_ENV "OTHELLO_LMR_MOVES"
+#define LMR_STEP_ENV "OTHELLO_LMR_STEP"
+
+/* killer moves kept for every ply */
+#define KILLER_SLOTS 2
+
+/*
+ * One frame of the search stack. The search keeps a single position and plays
+ * moves in place, so each ply holds the position's hash keys, which side is
+ * to move (0 for the side to move at the root), its move list and what is
+ * needed to take back the move played from it.
+ */
+typedef struct {
+    HashKey hash;
+    int side;
+    int moves[MAX_MOVES + 1];
+    int move;
+    Bitboard flips;
+    ChildBatch children;
+} SearchPly;
 
 const char *PLAYER_NAME_LOG = "my_player.log";
 
 clock_t start;
 double time_limit;
 
+/* search algorithm of this process, and the nodes it has searched */
+int search_mode = SEARCH_PVS;
+int aspiration_width = ASPIRATION_WIDTH;
+int aspiration_growth = ASPIRATION_GROWTH;
+int endgame_empties = ENDGAME_EMPTIES;
+int proof_empties = PROOF_EMPTIES;
+long proof_nodes = PROOF_NODES;
+double mpc_threshold = MPC_THRESHOLD;
+int lmr_depth = LMR_DEPTH;
+int lmr_moves = LMR_MOVES;
+int lmr_step = LMR_STEP;
+int ponder_enabled = 1;
+const char *book_file = BOOK_FILE;
+long long nodes_searched = 0;
+const char *SEARCH_MODE_NAMES[] = {"alphabeta", "pvs", "mtdf"};
+const char *PROOF_OUTCOME_NAMES[] = {"unknown", "win", "no win"};
+
+/* rank running a proof search for the current move, 0 if none or once its
+   result is in, and the winning move it proved, -1 if none */
+int proof_rank = 0;
+int proven_move = -1;
+
+/* the batch of root moves the master last sent out, counted over all moves,
+   depths and windows, so an alpha update can be matched to its search */
+int search_id = 0;
+
+/* on a worker, the search its root moves belong to, 0 while it has none,
+   the latest search the master stopped, and the time checks since it last
+   looked for a stop */
+int task_search = 0;
+int stopped_search = 0;
+int stop_polls = 0;
+
+/* workers pondering, ranks 1 to ponder_ranks; on a worker, whether it is
+   pondering, whether it has seen the master's stop, and the receive
+   posted for the stop with the reply it carries */
+int ponder_ranks = 0;
+int pondering = 0;
+int ponder_stopped = 0;
+MPI_Request ponder_request;
+int ponder_reply;
+
+/* the opening book, mapped on the master only */
+OpeningBook opening_book;
+
 void run_master(int, char *[]);
 int initialise_master(int, char *[], int *, int *, FILE **);
 
 void initialise_board(void);
-void free_board(void);
 void print_board(FILE *);
 void reset_board(FILE *);
-void restore_board(int *);
 void terminate_workers();
-int evaluate_board_state(int);
-int evaluate_moves(int, int, int, int, int);
-int *copy_curr_board();
-int get_loc(char *);
+int evaluate_board_state(Bitboard, Bitboard);
+int evaluate_leaf(Position *);
+int evaluate_moves(Position *, int, int, int, int, int, int);
+int receive_alpha(int, int, int);
 
 void run_worker(int);
+size_t transposition_megabytes(int, char *[]);
+void read_search_settings(void);
+int widen_window(int, int *, int *, int *);
+int last_midgame_depth(int, int);
+void start_proof(int, Position *);
+int check_proof(int, FILE *);
+void stop_search(int);
+int search_stop_requested(void);
+void start_ponder(int, FILE *);
+void stop_ponder(int, FILE *);
+void rank_replies(Position *, int *, int);
+void ponder(Position *, int);
+int ponder_stop_requested(void);
+int book_move(Position *, FILE *);
 
 int random_strategy(int, FILE *);
 int minimax_strategy(int, int, FILE *);
-int minimax(int, int, int, bool, int, int);
-void legal_moves(int *, int *, int);
-int check_direction(int, int, int, int, int, int);
+int negamax(Position *, int, int, int, int);
+int probcut(Position *, int, int, int, int, int *);
+int game_phase(Position *);
+int late_move_reduction(Position *, int, int);
+int mtdf(Position *, int, int, int, int, int);
+int search_root_move(Position *, int, int, int, int, int, int);
+void legal_moves(Position *, int *, int *);
+void order_moves(Position *, int, int *, int);
+void order_root_moves(int *, int);
+void move_to_front(int *, int, int);
+void order_by_history(int, int *, int);
+void record_cutoff(int, int, int);
+void clear_move_ordering(void);
+void age_move_ordering(void);
 void make_move(int, int);
-int make_temp_move(int, int);
-void flip_direction(int, int, int, int, int);
-int best_legal_move(int, int, int, int, int);
+void make_temp_move(Position *, int, int);
+void unmake_temp_move(Position *, int);
+int best_legal_move(Position *, int, int, int, int);
+int opponent_of(int);
+Position position_for(int);
 
-int check_if_time_up();
+int check_if_time_up(void);
 
-int *board;
+/* game board, with BLACK's discs in player and WHITE's discs in opponent */
+Position board;
+
+/* score of each root move, by square, from the last iteration that searched
+   it; the next iteration tries the best first */
+int root_scores[MAX_MOVES];
+
+/* moves that caused beta cutoffs: the latest at every ply, and a score for
+   every square by side, weighted by the depth of the cutoff */
+int killer_moves[MAX_PLY + 1][KILLER_SLOTS];
+int history_scores[2][MAX_MOVES];
+
+/* per-ply move lists and undo records for the search, with one frame past
+   the deepest ply for the keys of the positions evaluated there */
+SearchPly search_stack[MAX_PLY + 1];
 
 typedef struct {
+    Position position;
     int move;
-    int player_colour;
     int depth;
     int alpha;
     int beta;
+    int guess;
+    int search;
+    double time_limit;
 } MoveTask;
 
+/* a better alpha the master found for the root moves of one search */
+typedef struct {
+    int search;
+    int alpha;
+} AlphaUpdate;
+
+/* a root move's score, which is only a bound if the deadline stopped the
+   search */
 typedef struct {
     int move;
     int score;
+    int stopped;
+    long long nodes;
 } MoveResult;
 
+typedef struct {
+    int outcome;
+    int move;
+    long long nodes;
+} ProofResult;
+
+/* what a worker found pondering a reply: the best answer and its score from
+   the deepest depth it completed, 0 if none, and the scores of all answers
+   to order the real search by */
+typedef struct {
+    int reply;
+    int move;
+    int score;
+    int depth;
+    long long nodes;
+    int scores[MAX_MOVES];
+} PonderResult;
+
+/* the pondered results for the reply the opponent played, until the next
+   search takes them up */
+PonderResult pondered;
+
+/* the offline tools include this file for its search and have their own main */
+#ifndef PLAYER_NO_MAIN
 int main(int argc, char *argv[]) {
     int rank;
 
-    if (argc != 5) {
-        printf("Usage: %s <inetaddress> <port> <time_limit> <player_colour>\n",
+    if (argc != 5 && argc != 6) {
+        printf("Usage: %s <inetaddress> <port> <time_limit> <player_colour> [tt_megabytes]\n",
                argv[0]);
         return 1;
     }
@@ -109,6 +328,20 @@ int main(int argc, char *argv[]) {
     MPI_Init(&argc, &argv);
     MPI_Comm_rank(MPI_COMM_WORLD, &rank);
 
+    /* each process picks the fastest mobility kernel its CPU supports */
+    select_move_kernel();
+
+    /* every process reads the same settings from the environment */
+    read_search_settings();
+
+    /* each process keeps its own killer and history tables, and its own
+       transposition table, for the whole game */
+    clear_move_ordering();
+
+    if (!init_transposition_table(transposition_megabytes(argc, argv))) {
+        fprintf(stderr, "Rank %d: could not allocate the transposition table\n", rank);
+    }
+
     /* each process initialises their own board */
     initialise_board();
 
@@ -118,11 +351,479 @@ int main(int argc, char *argv[]) {
         run_worker(rank);
     }
 
-    free_board();
-
     MPI_Finalize();
     return 0;
 }
+#endif
+
+/**
+ * Returns the transposition table size to use, which is the same for every
+ * process as mpirun hands them all the same arguments and environment. The
+ * optional fifth argument takes precedence over OTHELLO_TT_MB.
+ *
+ * @param argc command line argument count
+ * @param argv command line argument vector
+ * @return table size in megabytes
+ */
+size_t transposition_megabytes(int argc, char *argv[]) {
+    const char *setting = getenv(TT_MEGABYTES_ENV);
+
+    if (argc > 5) {
+        setting = argv[5];
+    }
+
+    if (setting != NULL && atol(setting) > 0) {
+        return (size_t)atol(setting);
+    }
+
+    return TT_MEGABYTES;
+}
+
+/**
+ * Reads the search settings from the environment. OTHELLO_SEARCH selects the
+ * algorithm: "pvs" (the default), "alphabeta" or "mtdf", so they can be
+ * compared on the node counts in the log. OTHELLO_ASPIRATION sets the
+ * half-width of the aspiration window, 0 searching every depth with the full
+ * window, and OTHELLO_ASPIRATION_GROWTH the factor it grows by on a failure.
+ * OTHELLO_ENDGAME_EMPTIES sets how few empty squares the root must have for
+ * the game to be solved exactly, 0 never solving it. OTHELLO_PROOF_EMPTIES
+ * sets up to how many empty squares a spare worker tries to prove a win,
+ * 0 never trying, and OTHELLO_PROOF_NODES the size of its proof tree.
+ * OTHELLO_MPC sets the Multi-ProbCut threshold in standard deviations, 0
+ * searching every move to full depth. OTHELLO_LMR_DEPTH sets how deep a node
+ * must be searched for late moves to be reduced, and OTHELLO_LMR_MOVES how
+ * many moves are searched to full depth first, 0 reducing none;
+ * OTHELLO_LMR_STEP sets how much later and deeper a move must be for each
+ * further ply of reduction.
+ * OTHELLO_PONDER set to 0 keeps the workers idle on the opponent's time.
+ * OTHELLO_BOOK names the opening book file.
+ */
+void read_search_settings(void) {
+    const char *mode = getenv(SEARCH_MODE_ENV);
+    const char *width = getenv(ASPIRATION_WIDTH_ENV);
+    const char *growth = getenv(ASPIRATION_GROWTH_ENV);
+    const char *endgame = getenv(ENDGAME_EMPTIES_ENV);
+    const char *proof = getenv(PROOF_EMPTIES_ENV);
+    const char *budget = getenv(PROOF_NODES_ENV);
+    const char *cut = getenv(MPC_THRESHOLD_ENV);
+    const char *reduce_depth = getenv(LMR_DEPTH_ENV);
+    const char *reduce_moves = getenv(LMR_MOVES_ENV);
+    const char *reduce_step = getenv(LMR_STEP_ENV);
+    const char *ponder_setting = getenv(PONDER_ENV);
+    const char *book_setting = getenv(BOOK_FILE_ENV);
+
+    search_mode = SEARCH_PVS;
+
+    for (int i = 0; mode != NULL && i <= SEARCH_MTDF; i++) {
+        if (strcmp(mode, SEARCH_MODE_NAMES[i]) == 0) {
+            search_mode = i;
+        }
+    }
+
+    if (width != NULL && atoi(width) >= 0) {
+        aspiration_width = atoi(width);
+    }
+
+    if (growth != NULL && atoi(growth) >= 2) {
+        aspiration_growth = atoi(growth);
+    }
+
+    if (endgame != NULL && atoi(endgame) >= 0) {
+        endgame_empties = atoi(endgame);
+    }
+
+    if (proof != NULL && atoi(proof) >= 0) {
+        proof_empties = atoi(proof);
+    }
+
+    if (budget != NULL && atol(budget) > 0) {
+        proof_nodes = atol(budget);
+    }
+
+    if (cut != NULL && atof(cut) >= 0) {
+        mpc_threshold = atof(cut);
+    }
+
+    if (reduce_depth != NULL && atoi(reduce_depth) >= 2) {
+        lmr_depth = atoi(reduce_depth);
+    }
+
+    if (reduce_moves != NULL && atoi(reduce_moves) >= 0) {
+        lmr_moves = atoi(reduce_moves);
+    }
+
+    if (reduce_step != NULL && atoi(reduce_step) >= 1) {
+        lmr_step = atoi(reduce_step);
+    }
+
+    if (ponder_setting != NULL) {
+        ponder_enabled = atoi(ponder_setting) != 0;
+    }
+
+    if (book_setting != NULL) {
+        book_file = book_setting;
+    }
+}
+
+/**
+ * Checks a root score against the aspiration window it was searched with. A
+ * score on or past a bound of the window is itself only a bound, so that side
+ * of the window is moved past the score by the current width, which then
+ * grows for the next failure.
+ *
+ * @param score best root score found with the window
+ * @param alpha lower bound of the window, lowered on a fail low
+ * @param beta upper bound of the window, raised on a fail high
+ * @param width current width, grown when the window is widened
+ * @return 1 if the window was widened and the depth must be searched again
+ */
+int widen_window(int score, int *alpha, int *beta, int *width) {
+    if (score <= *alpha && *alpha > -SCORE_INFINITY) {
+        *alpha = (score - *width > -SCORE_INFINITY) ? score - *width : -SCORE_INFINITY;
+    } else if (score >= *beta && *beta < SCORE_INFINITY) {
+        *beta = (score + *width < SCORE_INFINITY) ? score + *width : SCORE_INFINITY;
+    } else {
+        return 0;
+    }
+
+    *width *= aspiration_growth;
+    return 1;
+}
+
+/**
+ * Finds the deepest ordinary search before the root is solved. Near the end
+ * of the game the depths run to half the empties, cheap beside the solve,
+ * so a solve that runs out of time still leaves a searched move to play.
+ *
+ * @param empties empty squares at the root
+ * @param max_depth deepest search the root allows
+ * @return the last depth searched before the solve, or max_depth when the
+ *         root is too far from the end to solve
+ */
+int last_midgame_depth(int empties, int max_depth) {
+    if (empties > endgame_empties) {
+        return max_depth;
+    }
+
+    return (empties + 1) / 2;
+}
+
+/**
+ * Starts a proof-number search of the root on the given worker. The worker
+ * searches until the master's deadline at most and answers with a
+ * ProofResult, which check_proof collects.
+ *
+ * @param prover rank of the worker
+ * @param root root position, viewed from the side to move
+ */
+void start_proof(int prover, Position *root) {
+    int number_of_moves = 1;
+    int command = PROVE_COMMAND;
+    MoveTask task;
+
+    memset(&task, 0, sizeof(task));
+    task.position = *root;
+    task.move = -1;
+    task.time_limit = time_limit - ((double)(clock() - start)) / CLOCKS_PER_SEC;
+
+    MPI_Send(&number_of_moves, 1, MPI_INT, prover, 0, MPI_COMM_WORLD);
+    MPI_Send(&command, 1, MPI_INT, prover, 1, MPI_COMM_WORLD);
+    MPI_Send(&task, sizeof(MoveTask), MPI_BYTE, prover, 2, MPI_COMM_WORLD);
+
+    proof_rank = prover;
+}
+
+/**
+ * Collects the result of the proof search, if one is running and has
+ * answered, and logs it.
+ *
+ * @param wait whether to wait for the result rather than only check for it
+ * @param fp pointer to the log file
+ * @return the winning move proven for this move, or -1 if none is
+ */
+int check_proof(int wait, FILE *fp) {
+    ProofResult result;
+    int flag = 1;
+
+    if (proof_rank == 0) {
+        return proven_move;
+    }
+
+    if (!wait) {
+        MPI_Iprobe(proof_rank, 6, MPI_COMM_WORLD, &flag, MPI_STATUS_IGNORE);
+    }
+
+    if (!flag) {
+        return proven_move;
+    }
+
+    MPI_Recv(&result, sizeof(ProofResult), MPI_BYTE, proof_rank, 6, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+    proof_rank = 0;
+
+    if (result.outcome == PROOF_WIN) {
+        proven_move = result.move;
+    }
+
+    fprintf(fp, "Proof search: %s (nodes: %lld)\n", PROOF_OUTCOME_NAMES[result.outcome], result.nodes);
+    fflush(fp);
+
+    return proven_move;
+}
+
+/**
+ * Tells the workers to stop searching the root moves of the current search
+ * and to answer with what they have, as they would at the deadline.
+ *
+ * @param number_of_workers number of workers searching root moves
+ */
+void stop_search(int number_of_workers) {
+    for (int worker = 1; worker <= number_of_workers; worker++) {
+        MPI_Send(&search_id, 1, MPI_INT, worker, 9, MPI_COMM_WORLD);
+    }
+}
+
+/**
+ * Checks, on a worker searching root moves, whether the master has stopped
+ * their search. The stops are only looked for every STOP_POLL_INTERVAL
+ * calls; stops for earlier searches are read and dropped.
+ *
+ * @return 1 once the search has been stopped
+ */
+int search_stop_requested(void) {
+    int flag;
+    int search;
+
+    if (stopped_search != task_search && ++stop_polls % STOP_POLL_INTERVAL == 0) {
+        for (;;) {
+            MPI_Iprobe(0, 9, MPI_COMM_WORLD, &flag, MPI_STATUS_IGNORE);
+
+            if (!flag) {
+                break;
+            }
+
+            MPI_Recv(&search, 1, MPI_INT, 0, 9, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+
+            if (search > stopped_search) {
+                stopped_search = search;
+            }
+        }
+    }
+
+    return stopped_search == task_search;
+}
+
+/**
+ * Starts pondering once our move is sent: each worker searches the position
+ * after one of the opponent's likeliest replies until stop_ponder stops it,
+ * so the search for our next move can start from its results.
+ *
+ * @param colour colour of the opponent, to move on the board
+ * @param fp pointer to the log file
+ */
+void start_ponder(int colour, FILE *fp) {
+    Position pos = position_for(colour);
+    int replies[MAX_MOVES];
+    int number_of_replies;
+    int size;
+
+    MPI_Comm_size(MPI_COMM_WORLD, &size);
+    ponder_ranks = 0;
+
+    if (!ponder_enabled || size < 2) {
+        return;
+    }
+
+    legal_moves(&pos, replies, &number_of_replies);
+
+    if (number_of_replies > 0) {
+        rank_replies(&pos, replies, number_of_replies);
+    } else if (get_moves(pos.opponent, pos.player) != 0) {
+        /* the opponent has to pass, so the reply is certain */
+        replies[0] = -1;
+        number_of_replies = 1;
+    } else {
+        return;
+    }
+
+    while (ponder_ranks < number_of_replies && ponder_ranks < size - 1) {
+        int number_of_moves = 1;
+        int command = PONDER_COMMAND;
+        MoveTask task;
+
+        memset(&task, 0, sizeof(task));
+        task.position = pos;
+        task.move = replies[ponder_ranks];
+        play_move(&task.position, task.move);
+
+        ponder_ranks++;
+
+        MPI_Send(&number_of_moves, 1, MPI_INT, ponder_ranks, 0, MPI_COMM_WORLD);
+        MPI_Send(&command, 1, MPI_INT, ponder_ranks, 1, MPI_COMM_WORLD);
+        MPI_Send(&task, sizeof(MoveTask), MPI_BYTE, ponder_ranks, 2, MPI_COMM_WORLD);
+    }
+
+    fprintf(fp, "Pondering %d of %d replies\n", ponder_ranks, number_of_replies);
+    fflush(fp);
+}
+
+/**
+ * Stops the pondering workers and keeps the results of the one that pondered
+ * the reply the opponent played, if any did, for the next search.
+ *
+ * @param reply move the opponent played, -1 for a pass, or PONDER_CANCELLED
+ * @param fp pointer to the log file
+ */
+void stop_ponder(int reply, FILE *fp) {
+    pondered.depth = 0;
+
+    for (int worker = 1; worker <= ponder_ranks; worker++) {
+        MPI_Send(&reply, 1, MPI_INT, worker, 7, MPI_COMM_WORLD);
+    }
+
+    for (int worker = 1; worker <= ponder_ranks; worker++) {
+        PonderResult result;
+
+        MPI_Recv(&result, sizeof(PonderResult), MPI_BYTE, worker, 8, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+
+        if (result.reply == reply && result.depth > 0) {
+            pondered = result;
+        }
+    }
+
+    if (pondered.depth > 0) {
+        fprintf(fp, "Pondered the reply %d to depth %d, best move: %d (score: %d, nodes: %lld)\n",
+                reply, pondered.depth, pondered.move, pondered.score, pondered.nodes);
+    } else if (reply != PONDER_CANCELLED) {
+        fprintf(fp, "The reply %d was not pondered\n", reply);
+    }
+    fflush(fp);
+
+    ponder_ranks = 0;
+}
+
+/**
+ * Orders the opponent's replies from the likeliest, by a shallow search
+ * from the opponent's point of view.
+ *
+ * @param pos position with the opponent to move
+ * @param replies the opponent's legal moves, reordered in place
+ * @param number_of_replies number of replies
+ */
+void rank_replies(Position *pos, int *replies, int number_of_replies) {
+    int scores[MAX_MOVES];
+    clock_t saved_start = start;
+    double saved_time_limit = time_limit;
+
+    /* the master's own deadline has passed, and the search is shallow */
+    start = clock();
+    time_limit = NO_TIME_LIMIT;
+
+    /* the master's searches are rooted at our moves, so the opponent, to
+       move here, is side 1 of the history table */
+    search_stack[0].hash = hash_position(pos);
+    search_stack[0].side = 1;
+
+    /* insertion sort, best first; move lists are short */
+    for (int i = 0; i < number_of_replies; i++) {
+        int reply = replies[i];
+        int j = i;
+
+        make_temp_move(pos, reply, 0);
+        int score = -negamax(pos, 1, PONDER_GUESS_DEPTH - 1, -SCORE_INFINITY, SCORE_INFINITY);
+        unmake_temp_move(pos, 0);
+
+        while (j > 0 && scores[j - 1] < score) {
+            replies[j] = replies[j - 1];
+            scores[j] = scores[j - 1];
+            j--;
+        }
+
+        replies[j] = reply;
+        scores[j] = score;
+    }
+
+    start = saved_start;
+    time_limit = saved_time_limit;
+}
+
+/**
+ * Ponders a reply on a worker: searches the position after it by iterative
+ * deepening, as the master would, until the master sends the stop, then
+ * answers with what the deepest completed depth found.
+ *
+ * @param pos position after the reply, with us to move
+ * @param reply reply pondered
+ */
+void ponder(Position *pos, int reply) {
+    PonderResult result;
+    long long nodes_before = nodes_searched;
+    int empties = BOARD_SQUARES - count_discs(pos->player | pos->opponent);
+    int max_depth = (empties < MAX_PLY) ? empties : MAX_PLY;
+
+    memset(&result, 0, sizeof(result));
+    result.reply = reply;
+    result.move = -1;
+
+    /* the stop is received into a posted receive, which the time checks
+       test now and then */
+    MPI_Irecv(&ponder_reply, 1, MPI_INT, 0, 7, MPI_COMM_WORLD, &ponder_request);
+    pondering = 1;
+    ponder_stopped = 0;
+    stop_polls = 0;
+
+    int solve_after = last_midgame_depth(empties, max_depth);
+
+    for (int depth = 1; depth <= max_depth; depth++) {
+        if (depth > solve_after) {
+            depth = SOLVE_DEPTH;
+        }
+
+        int move = best_legal_move(pos, depth, -SCORE_INFINITY, SCORE_INFINITY, 0);
+
+        /* only a stop the search saw cut it short; one that arrived after
+           its last check leaves the depth complete */
+        if (move < 0 || ponder_stopped) {
+            break;
+        }
+
+        result.move = move;
+        result.score = root_scores[move];
+        result.depth = depth;
+        memcpy(result.scores, root_scores, sizeof(result.scores));
+
+        /* a short depth can end between two tests, so test before the next */
+        if (!ponder_stopped) {
+            MPI_Test(&ponder_request, &ponder_stopped, MPI_STATUS_IGNORE);
+        }
+
+        if (ponder_stopped) {
+            break;
+        }
+    }
+
+    pondering = 0;
+
+    /* a search that reached the end waits for the stop all the same */
+    MPI_Wait(&ponder_request, MPI_STATUS_IGNORE);
+
+    result.nodes = nodes_searched - nodes_before;
+    MPI_Send(&result, sizeof(PonderResult), MPI_BYTE, 0, 8, MPI_COMM_WORLD);
+}
+
+/**
+ * Checks, on a pondering worker, whether the master has sent the stop, by
+ * testing the receive ponder posted for it every STOP_POLL_INTERVAL calls.
+ * Once seen, the stop is kept in ponder_stopped.
+ *
+ * @return 1 once the stop has arrived
+ */
+int ponder_stop_requested(void) {
+    if (!ponder_stopped && ++stop_polls % STOP_POLL_INTERVAL == 0) {
+        MPI_Test(&ponder_request, &ponder_stopped, MPI_STATUS_IGNORE);
+    }
+
+    return ponder_stopped;
+}
 
 /**
  * Runs the master process.
@@ -143,6 +844,14 @@ void run_master(int argc, char *argv[]) {
     if (initialise_master(argc, argv, &time_limit, &my_colour, &fp) != 0) {
         running = 1;
     }
+
+    /* the book is probed in place, so mapping it costs nothing up front */
+    if (open_book(&opening_book, book_file)) {
+        fprintf(fp, "Opening book: %s, %zu positions\n", book_file, opening_book.count);
+    } else {
+        fprintf(fp, "Opening book: none (%s)\n", book_file);
+    }
+    fflush(fp);
     
     if (my_colour == EMPTY)
         my_colour = BLACK;
@@ -155,6 +864,11 @@ void run_master(int argc, char *argv[]) {
         fprintf(fp, "Received message type: %d\n", message_type);
         fflush(fp);
 
+        /* whatever the message, the workers are needed for it or done */
+        if (ponder_ranks > 0) {
+            stop_ponder((message_type == PLAY_MOVE) ? opponent_move : PONDER_CANCELLED, fp);
+        }
+
         /* Received game termination message */
         if (message_type == GAME_TERMINATION) {
             fprintf(fp, "Game terminated.\n");
@@ -226,6 +940,9 @@ void run_master(int argc, char *argv[]) {
 
             print_board(fp);
 
+            /* the workers search the opponent's likeliest replies on its time */
+            start_ponder(opponent_of(my_colour), fp);
+
         /* Received opponent's move */
         } else if (message_type == PLAY_MOVE) {
             if (opponent_move < 0) {
@@ -234,7 +951,7 @@ void run_master(int argc, char *argv[]) {
             }
 
             fprintf(fp, "\nOpponent placing piece in row: %d, column: %d\n", opponent_move / BOARD_SIZE, opponent_move % BOARD_SIZE);
-            make_move(opponent_move, (my_colour + 1) % 2);
+            make_move(opponent_move, opponent_of(my_colour));
             print_board(fp);
         
         /* Received match reset message */
@@ -253,7 +970,8 @@ void run_master(int argc, char *argv[]) {
     if (!is_workers_terminated) {
         terminate_workers();
     }
-    
+
+    close_book(&opening_book);
     close_comms();
 }
 
@@ -288,9 +1006,38 @@ void run_worker(int rank) {
             continue;
         }
 
+        if (command == PROVE_COMMAND) {
+            MoveTask task;
+            ProofResult result;
+            ProofSearch proof = {(size_t)proof_nodes, check_if_time_up, 0, -1};
+
+            MPI_Recv(&task, sizeof(MoveTask), MPI_BYTE, 0, 2, MPI_COMM_WORLD, &status);
+
+            start = clock();
+            time_limit = task.time_limit;
+
+            result.outcome = prove_win(&task.position, &proof);
+            result.move = proof.move;
+            result.nodes = proof.nodes;
+
+            MPI_Send(&result, sizeof(ProofResult), MPI_BYTE, 0, 6, MPI_COMM_WORLD);
+            continue;
+        }
+
+        if (command == PONDER_COMMAND) {
+            MoveTask task;
+
+            MPI_Recv(&task, sizeof(MoveTask), MPI_BYTE, 0, 2, MPI_COMM_WORLD, &status);
+
+            ponder(&task.position, task.move);
+            continue;
+        }
+
         if (number_of_moves <= 0) {
-            fprintf(stderr, "Worker %d: No moves to process\n", rank); // Debug point F
-            
+            /* the master has finished a move, so this process's tables now
+               belong to an older search */
+            age_transposition_table();
+            age_move_ordering();
             continue;
         }
 
@@ -301,28 +1048,49 @@ void run_worker(int rank) {
             MPI_Recv(&tasks[i], sizeof(MoveTask), MPI_BYTE, 0, 2, MPI_COMM_WORLD, &status);
         }
 
+        /* search until the master's deadline, counted from when the tasks
+           were sent */
+        start = clock();
+        time_limit = tasks[0].time_limit;
+
         int compl_results = 0;
 
-        for (int i = 0; i < number_of_moves; i++) {
-            int flag;
-            MPI_Iprobe(0, 5, MPI_COMM_WORLD, &flag, &status);
+        /* the batch's moves share one window, so a score this worker found
+           inside it raises alpha for the moves after it */
+        int raised_alpha = -SCORE_INFINITY;
 
-            if (flag) {
-                int new_alpha;
-                MPI_Recv(&new_alpha, 1, MPI_INT, 0, 5, MPI_COMM_WORLD, &status);
+        task_search = tasks[0].search;
 
-                if (new_alpha > tasks[i].alpha) {
-                    tasks[i].alpha = new_alpha;
-                }
+        for (int i = 0; i < number_of_moves; i++) {
+            int window_alpha = tasks[i].alpha;
+
+            if (raised_alpha > tasks[i].alpha && raised_alpha < tasks[i].beta) {
+                tasks[i].alpha = raised_alpha;
             }
 
-            int score = evaluate_moves(tasks[i].move, tasks[i].player_colour, tasks[i].depth, tasks[i].alpha, tasks[i].beta);
+            /* the first call also clears out the updates left over from
+               earlier batches */
+            tasks[i].alpha = receive_alpha(tasks[i].search, tasks[i].alpha, tasks[i].beta);
+
+            /* once alpha has been raised, a move only has to be shown no
+               better than it, which PVS does with a null window first */
+            long long nodes_before = nodes_searched;
+            int score = evaluate_moves(&tasks[i].position, tasks[i].move, tasks[i].depth, tasks[i].alpha, tasks[i].beta,
+                                       tasks[i].guess, tasks[i].alpha <= window_alpha);
 
             results[compl_results].move = tasks[i].move;
             results[compl_results].score = score;
+            results[compl_results].stopped = check_if_time_up();
+            results[compl_results].nodes = nodes_searched - nodes_before;
+
+            if (!results[compl_results].stopped && score > raised_alpha) {
+                raised_alpha = score;
+            }
             compl_results++;
         }
 
+        task_search = 0;
+
         MPI_Send(&compl_results, 1, MPI_INT, 0, 3, MPI_COMM_WORLD);
 
         for (int i = 0; i < compl_results; i++) {
@@ -343,14 +1111,8 @@ void run_worker(int rank) {
  */
 void reset_board(FILE *fp) {
 
-    int mid = BOARD_SIZE / 2;
-    memset(board, EMPTY, sizeof(int) * BOARD_SIZE * BOARD_SIZE);
-
     // Set up the initial four pieces in the middle
-    board[mid * BOARD_SIZE + mid] = WHITE;
-    board[(mid - 1) * BOARD_SIZE + (mid - 1)] = WHITE;
-    board[mid * BOARD_SIZE + (mid - 1)] = BLACK;
-    board[(mid - 1) * BOARD_SIZE + mid] = BLACK;
+    initialise_board();
 
     fprintf(fp, "~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\n");
     fprintf(fp, "~~~~~~~~~~~~~ NEW MATCH ~~~~~~~~~~~~\n");
@@ -370,8 +1132,10 @@ int random_strategy(int my_colour, FILE *fp) {
     int number_of_moves;
     int *moves = malloc(sizeof(int) * MAX_MOVES);
 
+    Position pos = position_for(my_colour);
+
     /* get all legal moves */
-    legal_moves(moves, &number_of_moves, my_colour);
+    legal_moves(&pos, moves, &number_of_moves);
 
     /* check for pass */
     if (number_of_moves <= 0 || moves[0] == -1) {
@@ -400,7 +1164,9 @@ int minimax_strategy(int my_player_colour, int time, FILE *fp) {
     MPI_Comm_rank(MPI_COMM_WORLD, &rank);
     MPI_Comm_size(MPI_COMM_WORLD, &size);
 
-    legal_moves(moves_available, &number_of_moves, my_player_colour);
+    Position root = position_for(my_player_colour);
+
+    legal_moves(&root, moves_available, &number_of_moves);
     fprintf(fp, "Found %d legal moves\n", number_of_moves);
     fflush(fp);
 
@@ -409,124 +1175,314 @@ int minimax_strategy(int my_player_colour, int time, FILE *fp) {
         return -1;
     }
 
+    /* a book move is played at once, leaving the time for later moves */
+    int book = book_move(&root, fp);
+
+    if (book >= 0) {
+        pondered.depth = 0;
+        free(moves_available);
+        return book;
+    }
+
     start = clock();
     time_limit = (double) time;
 
+    age_transposition_table();
+    age_move_ordering();
+
     int best_possible_move = moves_available[0];
+    int previous_score = 0;
     int max_depth_compl = 0;
+    int results_in_flight = 0;
+    int empties = BOARD_SQUARES - count_discs(root.player | root.opponent);
 
-    for (int depth = 1; depth < 10; depth++) {
-        fprintf(fp, "Starting depth %d search\n", depth);
-        fflush(fp);
+    /* searching past the end of the game adds nothing, so deepening is only
+       bounded by the time, the empty squares and the search stack */
+    int max_depth = (empties < MAX_PLY) ? empties : MAX_PLY;
 
-        if (check_if_time_up()) {
-            break;
-        }
+    /* a worker that would get no root move tries to prove a win instead,
+       once the game is too long to solve but near enough the end */
+    proof_rank = 0;
+    proven_move = -1;
 
-        int number_of_workers = size - 1;
-        
-        if (number_of_workers <= 0) {
-            best_possible_move = best_legal_move(my_player_colour, depth, -999999, 999999, time_limit);
+    if (size >= 3 && size - 1 > number_of_moves && empties > endgame_empties && empties <= proof_empties) {
+        start_proof(size - 1, &root);
+    }
 
-            if (!check_if_time_up()) {
+    int number_of_workers = size - 1 - (proof_rank != 0);
+    int first_depth = 1;
+
+    /* the reply the opponent played was pondered, so the depths it completed
+       are not searched again */
+    if (pondered.depth > 0 && pondered.move >= 0 && (get_moves(root.player, root.opponent) & SQUARE_BIT(pondered.move))) {
+        best_possible_move = pondered.move;
+        previous_score = pondered.score;
+        max_depth_compl = pondered.depth;
+        first_depth = pondered.depth + 1;
+        memcpy(root_scores, pondered.scores, sizeof(root_scores));
+
+        fprintf(fp, "Starting from the pondered depth %d\n", pondered.depth);
+    }
+    pondered.depth = 0;
+
+    /* near the end of the game the ordinary depths stop short, and the
+       search after them solves the game */
+    int solve_after = last_midgame_depth(empties, max_depth);
+
+    for (int depth = first_depth; depth <= max_depth; depth++) {
+        if (depth > solve_after) {
+            depth = SOLVE_DEPTH;
+
+            fprintf(fp, "Solving the last %d empties\n", empties);
+        }
+
+        fprintf(fp, "Starting depth %d search\n", depth);
+        fflush(fp);
+
+        if (check_if_time_up() || check_proof(0, fp) >= 0) {
+            break;
+        }
+
+        if (depth > 1) {
+            order_root_moves(moves_available, number_of_moves);
+        }
+
+        /* from the second depth on, search a window around the previous
+           depth's score first */
+        int window_alpha = -SCORE_INFINITY;
+        int window_beta = SCORE_INFINITY;
+        int window_width = aspiration_width;
+
+        if (depth > 1 && aspiration_width > 0) {
+            window_alpha = previous_score - aspiration_width;
+            window_beta = previous_score + aspiration_width;
+        }
+
+        /* a solve first only finds whether the game is won, drawn or lost,
+           then finds the exact score on that side of zero */
+        if (depth == SOLVE_DEPTH) {
+            window_alpha = -1;
+            window_beta = 1;
+            window_width = SCORE_INFINITY;
+        }
+
+        if (number_of_workers <= 0) {
+            long long nodes_before = nodes_searched;
+            int curr_best_move;
+            int curr_score;
+
+            for (;;) {
+                curr_best_move = best_legal_move(&root, depth, window_alpha, window_beta, time_limit);
+                curr_score = root_scores[curr_best_move];
+
+                if (check_if_time_up()) {
+                    break;
+                }
+
+                /* a move that fails high beats the window, so it is kept
+                   even if there is no time left to find its score */
+                if (curr_score >= window_beta) {
+                    best_possible_move = curr_best_move;
+                }
+
+                if (!widen_window(curr_score, &window_alpha, &window_beta, &window_width)) {
+                    break;
+                }
+
+                fprintf(fp, "Depth %d fell outside the window, searching again in [%d, %d]\n",
+                        depth, window_alpha, window_beta);
+                fflush(fp);
+            }
+
+            if (!check_if_time_up()) {
+                best_possible_move = curr_best_move;
+                previous_score = curr_score;
                 max_depth_compl = depth;
             } else {
                 break;
             }
+            fprintf(fp, "Completed depth %d search, best move: %d (score: %d, nodes: %lld)\n",
+                    depth, best_possible_move, curr_score, nodes_searched - nodes_before);
+            fflush(fp);
             continue;
         }
 
-        int alpha = -999999;
-        int beta = 999999;
+        int curr_best_move;
+        int best_possible_score;
+        int tasks_compl;
+        int depth_stopped = 0;
+        long long depth_nodes = 0;
+
+        /* search the depth, again with a wider window whenever the best score
+           falls outside the window */
+        for (;;) {
+            int alpha = window_alpha;
+            int beta = window_beta;
 
-        int tasks_per_worker = (number_of_moves + number_of_workers - 1) / number_of_workers;
+            int tasks_per_worker = (number_of_moves + number_of_workers - 1) / number_of_workers;
 
-        int num_tasks_sent = 0;
+            search_id++;
+
+            int num_tasks_sent = 0;
         
-        for (int worker = 1; worker <= number_of_workers && num_tasks_sent < number_of_moves; worker++) {
-            int moves_to_be_sent = (num_tasks_sent + tasks_per_worker <= number_of_moves) ? tasks_per_worker : (number_of_moves - num_tasks_sent);
+            for (int worker = 1; worker <= number_of_workers && num_tasks_sent < number_of_moves; worker++) {
+                int moves_to_be_sent = (num_tasks_sent + tasks_per_worker <= number_of_moves) ? tasks_per_worker : (number_of_moves - num_tasks_sent);
 
-            if (moves_to_be_sent <= 0) continue;
+                if (moves_to_be_sent <= 0) continue;
 
-            MPI_Send(&moves_to_be_sent, 1, MPI_INT, worker, 0, MPI_COMM_WORLD);
+                MPI_Send(&moves_to_be_sent, 1, MPI_INT, worker, 0, MPI_COMM_WORLD);
 
-            int command = 0;
-            MPI_Send(&command, 1, MPI_INT, worker, 1, MPI_COMM_WORLD);
+                int command = 0;
+                MPI_Send(&command, 1, MPI_INT, worker, 1, MPI_COMM_WORLD);
 
-            for (int j = 0; j < moves_to_be_sent; j++) {
-                MoveTask task;
-                task.move = moves_available[num_tasks_sent + j];
-                task.player_colour = my_player_colour;
-                task.depth = depth;
-                task.alpha = alpha;
-                task.beta = beta;
+                for (int j = 0; j < moves_to_be_sent; j++) {
+                    MoveTask task;
+                    task.position = root;
+                    task.move = moves_available[num_tasks_sent + j];
+                    task.depth = depth;
+                    task.alpha = alpha;
+                    task.beta = beta;
+                    task.guess = root_scores[task.move];
+                    task.search = search_id;
+                    task.time_limit = time_limit - ((double)(clock() - start)) / CLOCKS_PER_SEC;
 
-                MPI_Send(&task, sizeof(MoveTask), MPI_BYTE, worker, 2, MPI_COMM_WORLD);
-            }
+                    MPI_Send(&task, sizeof(MoveTask), MPI_BYTE, worker, 2, MPI_COMM_WORLD);
+                }
 
-            num_tasks_sent += moves_to_be_sent;
-        }
-        fprintf(fp, "Sent %d tasks to workers for depth %d\n", num_tasks_sent, depth);
-        fflush(fp);
+                num_tasks_sent += moves_to_be_sent;
+            }
+            fprintf(fp, "Sent %d tasks to workers for depth %d\n", num_tasks_sent, depth);
+            fflush(fp);
         
-        int curr_best_move = -1;
-        int best_possible_score = -999999;
-        int tasks_compl = 0;
+            curr_best_move = -1;
+            best_possible_score = -SCORE_INFINITY;
+            tasks_compl = 0;
 
-        fprintf(fp, "Waiting for %d results from workers\n", num_tasks_sent - tasks_compl);
-        fflush(fp);
+            fprintf(fp, "Waiting for %d results from workers\n", num_tasks_sent - tasks_compl);
+            fflush(fp);
 
-        while (tasks_compl < num_tasks_sent) {
-            if (check_if_time_up()) {
-                break;
-            }
+            while (tasks_compl < num_tasks_sent) {
+                if (check_if_time_up() || depth_stopped || check_proof(0, fp) >= 0) {
+                    break;
+                }
 
-            int flag = 0;
-            MPI_Status status;
-            MPI_Iprobe(MPI_ANY_SOURCE, 3, MPI_COMM_WORLD, &flag, &status);
+                int flag = 0;
+                MPI_Status status;
+                MPI_Iprobe(MPI_ANY_SOURCE, 3, MPI_COMM_WORLD, &flag, &status);
 
-            if (!flag) {
-                continue;
-            }
+                if (!flag) {
+                    continue;
+                }
 
-            int worker_id = status.MPI_SOURCE;
-            int number_of_results;
+                int worker_id = status.MPI_SOURCE;
+                int number_of_results;
 
-            MPI_Recv(&number_of_results, 1, MPI_INT, worker_id, 3, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+                MPI_Recv(&number_of_results, 1, MPI_INT, worker_id, 3, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
 
-            for (int j = 0; j < number_of_results; j++) {
-                MoveResult results;
+                for (int j = 0; j < number_of_results; j++) {
+                    MoveResult results;
 
-                MPI_Recv(&results, sizeof(MoveResult), MPI_BYTE, worker_id, 4, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+                    MPI_Recv(&results, sizeof(MoveResult), MPI_BYTE, worker_id, 4, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+
+                    depth_nodes += results.nodes;
+                    tasks_compl++;
+
+                    /* the worker's clock can run out before this one, and
+                       then the depth is no more complete than if this one
+                       had */
+                    if (results.stopped) {
+                        depth_stopped = 1;
+                        continue;
+                    }
+
+                    root_scores[results.move] = results.score;
+
+                    if (results.score > best_possible_score) {
+                        best_possible_score = results.score;
+                        curr_best_move = results.move;
+                    }
 
-                if (results.score > best_possible_score) {
-                    best_possible_score = results.score;
-                    curr_best_move = results.move;
+                    /* a score at or above beta fails high, and narrows
+                       nothing the workers search */
+                    if (best_possible_score > alpha && best_possible_score < beta) {
+                        AlphaUpdate update = {search_id, best_possible_score};
 
-                    alpha = best_possible_score;
+                        alpha = best_possible_score;
 
-                    for (int k = 1; k <= number_of_workers; k++) {
-                        MPI_Send(&alpha, 1, MPI_INT, k, 5, MPI_COMM_WORLD);
+                        for (int k = 1; k <= number_of_workers; k++) {
+                            MPI_Send(&update, sizeof(AlphaUpdate), MPI_BYTE, k, 5, MPI_COMM_WORLD);
+                        }
                     }
                 }
-                tasks_compl++;
             }
+            fprintf(fp, "Waiting for %d results from workers\n", num_tasks_sent - tasks_compl);
+            fflush(fp);
+
+            results_in_flight = num_tasks_sent - tasks_compl;
+
+            if (check_if_time_up() || depth_stopped || curr_best_move == -1 || proven_move >= 0) {
+                break;
+            }
+
+            /* a move that fails high beats the window, so it is kept even if
+               there is no time left to find its score */
+            if (best_possible_score >= window_beta) {
+                best_possible_move = curr_best_move;
+            }
+
+            if (!widen_window(best_possible_score, &window_alpha, &window_beta, &window_width)) {
+                break;
+            }
+
+            fprintf(fp, "Depth %d fell outside the window, searching again in [%d, %d]\n",
+                    depth, window_alpha, window_beta);
+            fflush(fp);
         }
-        fprintf(fp, "Waiting for %d results from workers\n", num_tasks_sent - tasks_compl);
-        fflush(fp);
 
-        if (!check_if_time_up() && curr_best_move != -1) {
+        if (!check_if_time_up() && !depth_stopped && curr_best_move != -1 && proven_move < 0) {
             best_possible_move = curr_best_move;
+            previous_score = best_possible_score;
             max_depth_compl = depth;
 
         } else {
             break;
         }
-        fprintf(fp, "Completed depth %d search, best move: %d (score: %d)\n", 
-        depth, best_possible_move, best_possible_score);
+        fprintf(fp, "Completed depth %d search, best move: %d (score: %d, nodes: %lld)\n",
+        depth, best_possible_move, best_possible_score, depth_nodes);
+        fflush(fp);
+    }
+
+    /* a proven win is played at once, so the workers drop the root moves
+       still in flight rather than search them to the deadline */
+    if (proven_move >= 0 && results_in_flight > 0) {
+        stop_search(number_of_workers);
+    }
+
+    /* the workers stop at the same deadline, or sooner when told to, so the
+       results of an abandoned depth arrive shortly; collect them so the next
+       move does not take them for its own */
+    while (results_in_flight > 0) {
+        MPI_Status status;
+        int number_of_results;
+
+        MPI_Recv(&number_of_results, 1, MPI_INT, MPI_ANY_SOURCE, 3, MPI_COMM_WORLD, &status);
+
+        for (int j = 0; j < number_of_results; j++) {
+            MoveResult results;
+
+            MPI_Recv(&results, sizeof(MoveResult), MPI_BYTE, status.MPI_SOURCE, 4, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+        }
+        results_in_flight -= number_of_results;
+    }
+
+    /* the proof search also stops at the deadline, unless it has already
+       answered; a proven win beats any search result */
+    if (check_proof(1, fp) >= 0) {
+        best_possible_move = proven_move;
+
+        fprintf(fp, "Playing the proven win %d\n", proven_move);
         fflush(fp);
     }
-    
 
     for (int worker = 1; worker < size; worker++) {
         int zero_moves = 0;
@@ -536,254 +1492,615 @@ int minimax_strategy(int my_player_colour, int time, FILE *fp) {
         MPI_Send(&command, 1, MPI_INT, worker, 1, MPI_COMM_WORLD);
     }
 
+    if (max_depth_compl == SOLVE_DEPTH) {
+        fprintf(fp, "Depth reached: solved the last %d empties\n", empties);
+    } else {
+        fprintf(fp, "Depth reached: %d of %d\n", max_depth_compl, max_depth);
+    }
+
     free(moves_available);
     fprintf(fp, "Finished minimax_strategy, best move: %d\n", best_possible_move);
     fflush(fp);
     return best_possible_move;
 }
 
-int minimax(int depth, int alpha, int beta, bool maximizing, int player_colour, int curr_colour) {
+/**
+ * Negamax alpha-beta search. Positions are always viewed from the side to
+ * move, so a single move loop serves both players: every score is from the
+ * mover's point of view and a child's score is negated on the way back up.
+ *
+ * Results are stored in the transposition table under the key kept in the
+ * search stack, and a stored result that is deep enough and conclusive for
+ * the window is returned without searching. Searches cut short by the time
+ * limit are not stored.
+ *
+ * In PVS mode only the first move gets the full window. The others are
+ * searched with a null window to prove they are no better than alpha, and
+ * only a move that fails high inside the window is searched again in full.
+ * Nodes that a shallow search predicts to fall outside the window are cut
+ * by Multi-ProbCut, and moves late in the list are first searched shallower
+ * with a null window, and only searched to full depth if they beat alpha.
+ *
+ * @param pos position to search, viewed from the side to move
+ * @param ply distance from the root, which selects the search stack frame
+ * @param depth remaining depth to search
+ * @param alpha lower bound for the mover
+ * @param beta upper bound for the mover
+ * @return the score of the position for the side to move
+ */
+int negamax(Position *pos, int ply, int depth, int alpha, int beta) {
+    nodes_searched++;
 
-    if (depth <= 0 || depth > 10 || check_if_time_up()) {
-        return evaluate_board_state(player_colour);
+    if (depth <= 0 || ply >= MAX_PLY || check_if_time_up()) {
+        return evaluate_leaf(pos);
     }
 
-    int *moves_available = malloc(sizeof(int) * MAX_MOVES);
+    uint64_t key = search_stack[ply].hash.key;
+    TTEntry *entry = probe_transposition(key);
+    int stored_move = (entry != NULL) ? entry->move : -1;
+
+    if (entry != NULL && entry->depth >= depth) {
+        if ((entry->bound & BOUND_LOWER) && entry->lower >= beta) {
+            return entry->lower;
+        }
+        if ((entry->bound & BOUND_UPPER) && entry->upper <= alpha) {
+            return entry->upper;
+        }
+        if (entry->bound == BOUND_EXACT && entry->lower == entry->upper) {
+            return entry->lower;
+        }
+    }
+
+    int cut_score;
+
+    if (probcut(pos, ply, depth, alpha, beta, &cut_score)) {
+        return cut_score;
+    }
+
+    int *moves_available = search_stack[ply].moves;
     int number_of_moves;
+    int alpha_orig = alpha;
 
-    legal_moves(moves_available, &number_of_moves, curr_colour);
+    legal_moves(pos, moves_available, &number_of_moves);
 
-    if (number_of_moves <= 0) {
-        int opp_colour = (curr_colour + 1) % 2;
-        int *opp_moves_available = malloc(sizeof(int) * MAX_MOVES);
-        int opp_number_of_moves;
+    /* children that are leaves are not worth expanding twice */
+    if (depth >= 2) {
+        order_moves(pos, ply, moves_available, number_of_moves);
+    } else {
+        order_by_history(ply, moves_available, number_of_moves);
+    }
 
-        legal_moves(opp_moves_available, &opp_number_of_moves, opp_colour);
+    /* then the moves that cut off at this ply in sibling positions, and
+       before them the best move of an earlier search of this position,
+       usually the previous iteration's, which is the most likely to cut off */
+    for (int k = KILLER_SLOTS - 1; k >= 0; k--) {
+        if (killer_moves[ply][k] >= 0) {
+            move_to_front(moves_available, number_of_moves, killer_moves[ply][k]);
+        }
+    }
 
-        if (opp_number_of_moves <= 0) {
-            free(opp_moves_available);
-            free(moves_available);
+    if (stored_move >= 0) {
+        move_to_front(moves_available, number_of_moves, stored_move);
+    }
 
-            return evaluate_board_state(player_colour);
+    if (number_of_moves <= 0) {
+        if (get_moves(pos->opponent, pos->player) == 0) {
+            return evaluate_leaf(pos);
         }
 
-        int score = minimax(depth - 1, alpha, beta, !maximizing, player_colour, opp_colour);
-        
-        free(opp_moves_available);
-        free(moves_available);
+        make_temp_move(pos, -1, ply);
+
+        int score = -negamax(pos, ply + 1, depth - 1, -beta, -alpha);
+
+        unmake_temp_move(pos, ply);
 
         return score;
     }
 
-    int best_possible_score;
-
-    if (maximizing) {
-        best_possible_score = -9999999;
+    int best_possible_score = -9999999;
+    int best_possible_move = -1;
 
-        for (int i = 0; i < number_of_moves; i++) {
-            int *curr_board_copy = copy_curr_board();
+    for (int i = 0; i < number_of_moves; i++) {
+        make_temp_move(pos, moves_available[i], ply);
 
-            make_temp_move(moves_available[i], curr_colour);
+        int reduction = late_move_reduction(pos, depth, i);
+        int score = alpha + 1;
 
-            int score = minimax(depth - 1, alpha, beta, false, player_colour, (curr_colour + 1) % 2);
+        if (reduction > 0) {
+            score = -negamax(pos, ply + 1, depth - 1 - reduction, -alpha - 1, -alpha);
+        }
 
-            restore_board(curr_board_copy);
+        /* a reduced search that fails low is taken as it is */
+        if (score > alpha && search_mode == SEARCH_PVS && i > 0) {
+            score = -negamax(pos, ply + 1, depth - 1, -alpha - 1, -alpha);
 
-            if (score > best_possible_score) {
-                best_possible_score = score;
+            if (score > alpha && score < beta) {
+                score = -negamax(pos, ply + 1, depth - 1, -beta, -alpha);
             }
+        } else if (score > alpha) {
+            score = -negamax(pos, ply + 1, depth - 1, -beta, -alpha);
+        }
 
-            if (alpha < best_possible_score) {
-                alpha = best_possible_score;
-            }
+        unmake_temp_move(pos, ply);
 
-            if (beta <= alpha) {
-                break;
-            }
+        if (score > best_possible_score) {
+            best_possible_score = score;
+            best_possible_move = moves_available[i];
         }
 
-        free(moves_available);
+        if (alpha < best_possible_score) {
+            alpha = best_possible_score;
+        }
 
-        return best_possible_score;
+        if (beta <= alpha) {
+            record_cutoff(ply, moves_available[i], depth);
+            break;
+        }
+    }
 
-    } else {
-        best_possible_score = 9999999;
-        
-        for (int i = 0; i < number_of_moves; i++) {
-            int *curr_board_copy = copy_curr_board();
-            
-            make_temp_move(moves_available[i], curr_colour);
+    if (!check_if_time_up()) {
+        int bound = BOUND_EXACT;
 
-            int score = minimax(depth - 1, alpha, beta, true, player_colour, (curr_colour + 1) % 2);
+        if (best_possible_score <= alpha_orig) {
+            bound = BOUND_UPPER;
+        } else if (best_possible_score >= beta) {
+            bound = BOUND_LOWER;
+        }
 
-            restore_board(curr_board_copy);
+        store_transposition(key, depth, bound, best_possible_score, best_possible_move);
+    }
 
-            if (score < best_possible_score) {
-                best_possible_score = score;
-            }
+    return best_possible_score;
+}
 
-            if (beta > best_possible_score) {
-                beta = best_possible_score;
-            }
+/**
+ * Multi-ProbCut. A deep score is predicted from a shallow one by a linear
+ * fit, deep = slope * shallow + offset, which misses by sigma on average.
+ * A null-window shallow search then checks whether the shallow score is far
+ * enough past beta, or below alpha, that the deep score is very likely past
+ * it too, in which case the node is cut without the deep search. The fit
+ * depends on the depth and the game phase and is made offline by
+ * tools/fit_mpc; mpc_threshold is how many sigmas count as far enough.
+ *
+ * @param pos position to search, viewed from the side to move
+ * @param ply distance from the root, which selects the search stack frame
+ * @param depth remaining depth of the deep search
+ * @param alpha lower bound for the mover
+ * @param beta upper bound for the mover
+ * @param score set to the bound the node is cut at
+ * @return 1 if the node is cut, 0 if it must be searched
+ */
+int probcut(Position *pos, int ply, int depth, int alpha, int beta, int *score) {
+    if (!MPC_FITTED || mpc_threshold <= 0 || depth < MPC_MIN_DEPTH || depth > MPC_MAX_DEPTH ||
+        alpha <= -SCORE_INFINITY || beta >= SCORE_INFINITY) {
+        return 0;
+    }
 
-            if (beta <= alpha) {
-                break;
-            }
-        }
+    const MpcParams *fit = &MPC_PARAMS[game_phase(pos)][depth];
+    double margin = mpc_threshold * fit->sigma;
 
-        free(moves_available);
+    if (fit->slope <= 0) {
+        return 0;
+    }
 
-        return best_possible_score;
+    /* the lowest shallow score predicting a deep score of at least beta,
+       rounded up, and the highest predicting at most alpha, rounded down */
+    double high = (beta + margin - fit->offset) / fit->slope;
+    double low = (alpha - margin - fit->offset) / fit->slope;
+    int bound = (int)high;
+
+    if (bound < high) {
+        bound++;
+    }
+
+    if (negamax(pos, ply, fit->shallow, bound - 1, bound) >= bound) {
+        *score = beta;
+        return 1;
+    }
+
+    bound = (int)low;
+
+    if (bound > low) {
+        bound--;
+    }
+
+    if (negamax(pos, ply, fit->shallow, bound, bound + 1) <= bound) {
+        *score = alpha;
+        return 1;
     }
+
+    return 0;
 }
 
-void flip_direction(int x, int y, int dx, int dy, int my_colour) {
-    int i = x + dx;
-    int j = y + dy;
+/**
+ * Returns how many plies shallower a move is first searched, given how deep
+ * its node is searched and where the move is in the node's move list. The
+ * first moves, which ordering makes the likeliest to be best, are never
+ * reduced, and neither is anything once the game is close enough to its
+ * end for the endgame solver, or for the search to reach the end, as
+ * scores there are exact and an error costs the game.
+ *
+ * @param pos position the move is played from, after the move
+ * @param depth remaining depth of the node the move is played from
+ * @param index position of the move in the node's move list
+ * @return plies to take off the move's depth, 0 to search it in full
+ */
+int late_move_reduction(Position *pos, int depth, int index) {
+    if (lmr_moves <= 0 || index < lmr_moves || depth < lmr_depth) {
+        return 0;
+    }
+
+    int empties = BOARD_SQUARES - count_discs(pos->player | pos->opponent);
 
-    // Move along the direction and flip pieces until we hit a piece of
-    // my_colour
-    while (i >= 0 && i < BOARD_SIZE && j >= 0 && j < BOARD_SIZE &&
-           board[i * BOARD_SIZE + j] != my_colour) {
-        board[i * BOARD_SIZE + j] = my_colour;
-        i += dx;
-        j += dy;
+    if (empties <= endgame_empties || depth > empties) {
+        return 0;
     }
+
+    int further = (index - lmr_moves < depth - lmr_depth) ? index - lmr_moves : depth - lmr_depth;
+    int reduction = 1 + further / lmr_step;
+
+    /* leave the move at least one ply */
+    return (reduction < depth - 1) ? reduction : depth - 2;
 }
 
 /**
- * Applies the given move to the board.
+ * Looks the root up in the opening book.
  *
- * @param move move to apply
- * @param my_colour colour of the player
+ * @param root root position, viewed from the side to move
+ * @param fp pointer to the log file
+ * @return the book move, or -1 if the position is not in the book
  */
-void make_move(int move, int colour) {
-    int row = move / BOARD_SIZE;
-    int col = move % BOARD_SIZE;
-    int opp_colour = (colour == WHITE) ? BLACK : WHITE;
-    board[row * BOARD_SIZE + col] = colour;
-
-    // Check and flip in all 8 directions
-    for (int dx = -1; dx <= 1; dx++) {
-        for (int dy = -1; dy <= 1; dy++) {
-            if (dx == 0 && dy == 0)
-                continue; // Skip the current cell
-
-            int i = row + dx;
-            int j = col + dy;
-            int found_opp = 0;
-
-            // Move in the direction and check for opponent's pieces followed by
-            // my piece
-            while (i >= 0 && i < BOARD_SIZE && j >= 0 && j < BOARD_SIZE) {
-                if (board[i * BOARD_SIZE + j] == opp_colour) {
-                    found_opp = 1;
-                    i += dx;
-                    j += dy;
-                } else if (board[i * BOARD_SIZE + j] == colour && found_opp) {
-                    flip_direction(row, col, dx, dy, colour);
-                    break; // Stop checking this direction as we've found a
-                           // valid line
-                } else {
-                    break; // No valid line in this direction
-                }
-            }
+int book_move(Position *root, FILE *fp) {
+    const BookEntry *entry = probe_book(&opening_book, hash_position(root).key);
+
+    /* a key collision could name a move that is not legal here */
+    if (entry == NULL || entry->move < 0 || !(get_moves(root->player, root->opponent) & SQUARE_BIT(entry->move))) {
+        return -1;
+    }
+
+    fprintf(fp, "Book move %d (score: %d, depth: %d, games: %u)\n", entry->move, entry->score,
+            entry->depth, (unsigned)entry->games);
+    fflush(fp);
+
+    return entry->move;
+}
+
+/**
+ * Returns the game phase a position is in for the Multi-ProbCut fit, from 0
+ * at the start of the game to MPC_PHASES - 1 at the end.
+ *
+ * @param pos position to classify
+ * @return the phase of the position
+ */
+int game_phase(Position *pos) {
+    int played = count_discs(pos->player | pos->opponent) - 4;
+
+    return played * MPC_PHASES / (BOARD_SQUARES - 3);
+}
+
+/**
+ * MTD(f) search. The score is found by a series of null-window negamax
+ * searches, each of which only says whether the score is above or below a
+ * test value, starting from a guess, usually the previous iteration's score.
+ * Each result narrows the range the score can be in until the range closes.
+ * The transposition table keeps the bounds every search proves, so the
+ * repeated searches mostly replay stored results.
+ *
+ * Only scores inside the window matter: the search stops as soon as the
+ * score is known to be at most alpha or at least beta, and returns a bound,
+ * as negamax does.
+ *
+ * @param pos position to search, viewed from the side to move
+ * @param ply distance from the root, which selects the search stack frame
+ * @param depth remaining depth to search
+ * @param guess first estimate of the score
+ * @param alpha lower bound for the mover
+ * @param beta upper bound for the mover
+ * @return the score of the position for the side to move
+ */
+int mtdf(Position *pos, int ply, int depth, int guess, int alpha, int beta) {
+    int lower = alpha;
+    int upper = beta;
+    int score = guess;
+
+    if (score < lower) {
+        score = lower;
+    } else if (score > upper) {
+        score = upper;
+    }
+
+    while (lower < upper && !check_if_time_up()) {
+        int test = (score == lower) ? score + 1 : score;
+
+        score = negamax(pos, ply, depth, test - 1, test);
+
+        if (score < test) {
+            upper = score;
+        } else {
+            lower = score;
         }
     }
+
+    return score;
 }
 
 /**
- * Checks if the given direction is valid. A direction is valid if it sandwiches
- * at least one of the opponent's pieces between the piece being placed and
- * another piece of the player's colour.
+ * Searches one root move with the selected search algorithm and returns its
+ * score. Alpha-beta searches the full window. PVS searches the first move
+ * with the full window and the others with a null window, searching again
+ * when a move turns out better than alpha. MTD(f) converges on the score
+ * from the guess. A search to SOLVE_DEPTH solves the position after the move
+ * exactly, as PVS does, and scores it by the final disc difference.
  *
- * @param x x-coordinate of the piece being placed
- * @param y y-coordinate of the piece being placed
- * @param dx x-direction to check
- * @param dy y-direction to check
- * @param my_colour colour of the player
- * @param opp_colour colour of the opponent
- * @return 1 if the direction is valid, 0 otherwise
+ * @param pos root position, viewed from the side to move
+ * @param move root move to search
+ * @param depth depth to search the root to
+ * @param alpha lower bound for the root
+ * @param beta upper bound for the root
+ * @param guess the move's score from the previous iteration
+ * @param first whether the move is the first searched at the root
+ * @return the score of the move
  */
-int check_direction(int x, int y, int dx, int dy, int my_colour,
-                    int opp_colour) {
-    int i = x + dx;
-    int j = y + dy;
-    int found_opp = 0; // Flag to check if at least one opponent piece is found
-
-    while (i >= 0 && i < BOARD_SIZE && j >= 0 && j < BOARD_SIZE) {
-        if (board[i * BOARD_SIZE + j] == opp_colour) {
-            found_opp = 1;
-            i += dx;
-            j += dy;
-        } else if (board[i * BOARD_SIZE + j] == my_colour && found_opp) {
-            return 1; // Valid direction as it sandwiches opponent's pieces
+int search_root_move(Position *pos, int move, int depth, int alpha, int beta, int guess, int first) {
+    int score;
+
+    make_temp_move(pos, move, 0);
+
+    if (depth == SOLVE_DEPTH) {
+        EndgameSearch solve = {0, check_if_time_up, 0};
+
+        if (!first) {
+            score = -solve_endgame(pos, -alpha - 1, -alpha, &solve);
+
+            if (score > alpha && score < beta) {
+                score = -solve_endgame(pos, -beta, -alpha, &solve);
+            }
         } else {
-            return 0; // Either empty or own piece without sandwiching
-                      // opponent's pieces
+            score = -solve_endgame(pos, -beta, -alpha, &solve);
+        }
+
+        nodes_searched += solve.nodes;
+    } else if (search_mode == SEARCH_MTDF) {
+        score = -mtdf(pos, 1, depth - 1, -guess, -beta, -alpha);
+    } else if (search_mode == SEARCH_PVS && !first) {
+        score = -negamax(pos, 1, depth - 1, -alpha - 1, -alpha);
+
+        if (score > alpha && score < beta) {
+            score = -negamax(pos, 1, depth - 1, -beta, -alpha);
         }
+    } else {
+        score = -negamax(pos, 1, depth - 1, -beta, -alpha);
     }
-    return 0;
+
+    unmake_temp_move(pos, 0);
+
+    return score;
 }
 
 /**
- * Gets a list of legal moves for the current board, and stores them in the
- * moves array followed by a -1. Also stores the number of legal moves in the
- * number_of_moves variable.
+ * Applies the given move to the board.
+ *
+ * @param move move to apply
+ * @param my_colour colour of the player
+ */
+void make_move(int move, int colour) {
+    Bitboard *mine = (colour == WHITE) ? &board.opponent : &board.player;
+    Bitboard *theirs = (colour == WHITE) ? &board.player : &board.opponent;
+    Bitboard flips = get_flips(*mine, *theirs, move);
+
+    *mine |= flips | SQUARE_BIT(move);
+    *theirs ^= flips;
+}
+
+/**
+ * Gets a list of legal moves for the player to move in the given position, and
+ * stores them in the moves array followed by a -1. Also stores the number of
+ * legal moves in the number_of_moves variable.
  *
  * What is a legal move? A legal move is a move that results in at least one of
  * the opponent's pieces being flipped. That is if there is at least one piece
  * of the opponent's colour between the piece being placed and another piece of
  * the player's colour.
  *
+ * @param pos position to generate moves for
  * @param moves array to store the legal moves in
  * @param number_of_moves variable to store the number of legal moves in
  */
-void legal_moves(int *moves, int *number_of_moves, int my_colour) {
-    int opp_colour = (my_colour == WHITE) ? BLACK : WHITE;
-    *number_of_moves = 0;
+void legal_moves(Position *pos, int *moves, int *number_of_moves) {
+    *number_of_moves = list_moves(get_moves(pos->player, pos->opponent), moves);
+}
 
-    for (int i = 0; i < BOARD_SIZE; i++) {
-        for (int j = 0; j < BOARD_SIZE; j++) {
-            if (board[i * BOARD_SIZE + j] != EMPTY)
-                continue;
+/**
+ * Orders the given moves so that the moves leaving the opponent the fewest
+ * replies are searched first, with ties going to the move with the higher
+ * history score. The children and their mobility come from one batched
+ * expansion of the position.
+ *
+ * @param pos position the moves are played in
+ * @param ply search stack frame whose child batch is used
+ * @param moves array of legal moves to order
+ * @param number_of_moves number of legal moves
+ */
+void order_moves(Position *pos, int ply, int *moves, int number_of_moves) {
+    ChildBatch *batch = &search_stack[ply].children;
+    int *history = history_scores[search_stack[ply].side];
+    long long replies[MAX_MOVES];
 
-            int moveFound =
-                0; // Flag to indicate if a legal move is found for the cell
+    if (number_of_moves < 2) {
+        return;
+    }
 
-            // Check all 8 directions from the current cell
-            for (int dx = -1; dx <= 1 && !moveFound; dx++) {
-                for (int dy = -1; dy <= 1 && !moveFound; dy++) {
-                    if (dx == 0 && dy == 0)
-                        continue; // Skip checking the current cell
+    generate_children(pos, get_moves(pos->player, pos->opponent), batch);
 
-                    if (check_direction(i, j, dx, dy, my_colour, opp_colour)) {
-                        moves[(*number_of_moves)++] = i * BOARD_SIZE + j;
-                        moveFound = 1; // A legal move is found, no need to
-                                       // check other directions
-                    }
-                }
+    /* insertion sort, move lists are short */
+    for (int i = 0; i < batch->count; i++) {
+        int square = batch->square[i];
+        long long key = ((long long)count_discs(batch->mobility[i]) << 32) - history[square];
+        int j = i;
+
+        while (j > 0 && replies[j - 1] > key) {
+            moves[j] = moves[j - 1];
+            replies[j] = replies[j - 1];
+            j--;
+        }
+
+        moves[j] = square;
+        replies[j] = key;
+    }
+}
+
+/**
+ * Orders the given moves by their history scores, highest first. Used where
+ * the children are leaves and not worth expanding to order by mobility.
+ *
+ * @param ply search stack frame of the position, which gives the side to move
+ * @param moves array of legal moves to order
+ * @param number_of_moves number of legal moves
+ */
+void order_by_history(int ply, int *moves, int number_of_moves) {
+    int *history = history_scores[search_stack[ply].side];
+
+    /* insertion sort, move lists are short */
+    for (int i = 1; i < number_of_moves; i++) {
+        int move = moves[i];
+        int j = i;
+
+        while (j > 0 && history[moves[j - 1]] < history[move]) {
+            moves[j] = moves[j - 1];
+            j--;
+        }
+
+        moves[j] = move;
+    }
+}
+
+/**
+ * Records a move that caused a beta cutoff: it becomes the first killer move
+ * of its ply, and its history score for the side that played it grows with
+ * the square of the remaining depth, so cutoffs near the root count most.
+ *
+ * @param ply search stack frame the move was played from
+ * @param move move that caused the cutoff
+ * @param depth remaining depth at the cutoff
+ */
+void record_cutoff(int ply, int move, int depth) {
+    int *killers = killer_moves[ply];
+
+    if (killers[0] != move) {
+        for (int k = KILLER_SLOTS - 1; k > 0; k--) {
+            killers[k] = killers[k - 1];
+        }
+        killers[0] = move;
+    }
+
+    history_scores[search_stack[ply].side][move] += depth * depth;
+}
+
+/**
+ * Empties the killer and history tables.
+ */
+void clear_move_ordering(void) {
+    for (int ply = 0; ply <= MAX_PLY; ply++) {
+        for (int k = 0; k < KILLER_SLOTS; k++) {
+            killer_moves[ply][k] = -1;
+        }
+    }
+
+    memset(history_scores, 0, sizeof(history_scores));
+}
+
+/**
+ * Carries the killer and history tables over to the next move. The next
+ * search starts two plies further into the game, so killers move up two
+ * plies, and history scores are halved so recent cutoffs count for more.
+ */
+void age_move_ordering(void) {
+    for (int ply = 0; ply <= MAX_PLY; ply++) {
+        for (int k = 0; k < KILLER_SLOTS; k++) {
+            killer_moves[ply][k] = (ply + 2 <= MAX_PLY) ? killer_moves[ply + 2][k] : -1;
+        }
+    }
+
+    for (int side = 0; side < 2; side++) {
+        for (int square = 0; square < MAX_MOVES; square++) {
+            history_scores[side][square] /= 2;
+        }
+    }
+}
+
+/**
+ * Orders root moves by their scores from the previous iteration, best first.
+ * Moves with equal scores keep their order.
+ *
+ * @param moves array of root moves to order
+ * @param number_of_moves number of root moves
+ */
+void order_root_moves(int *moves, int number_of_moves) {
+    /* insertion sort, move lists are short */
+    for (int i = 1; i < number_of_moves; i++) {
+        int move = moves[i];
+        int j = i;
+
+        while (j > 0 && root_scores[moves[j - 1]] < root_scores[move]) {
+            moves[j] = moves[j - 1];
+            j--;
+        }
+
+        moves[j] = move;
+    }
+}
+
+/**
+ * Moves the given move to the front of a move list, keeping the order of the
+ * others. Nothing changes if the move is not in the list.
+ *
+ * @param moves array of moves
+ * @param number_of_moves number of moves
+ * @param move move to search first
+ */
+void move_to_front(int *moves, int number_of_moves, int move) {
+    for (int i = 0; i < number_of_moves; i++) {
+        if (moves[i] == move) {
+            for (; i > 0; i--) {
+                moves[i] = moves[i - 1];
             }
+            moves[0] = move;
+            return;
         }
     }
+}
+
+/**
+ * Returns the colour of the given player's opponent.
+ *
+ * @param colour colour of the player
+ * @return colour of the opponent
+ */
+int opponent_of(int colour) { return (colour == WHITE) ? BLACK : WHITE; }
+
+/**
+ * Returns the game board as a position viewed from the given colour.
+ *
+ * @param colour colour of the player the position belongs to
+ * @return the oriented position
+ */
+Position position_for(int colour) {
+    Position pos = board;
+
+    if (colour == WHITE) {
+        pos.player = board.opponent;
+        pos.opponent = board.player;
+    }
 
-    moves[*number_of_moves] = -1; // End of moves
+    return pos;
 }
 
 /**
  * Initialises the board for the game.
  */
 void initialise_board(void) {
-    int mid = BOARD_SIZE / 2;
-
-    board = malloc(sizeof(int) * BOARD_SIZE * BOARD_SIZE);
-    memset(board, EMPTY, sizeof(int) * BOARD_SIZE * BOARD_SIZE);
-
     /* plave initial pieces */
-    board[mid * BOARD_SIZE + mid] = WHITE;
-    board[(mid - 1) * BOARD_SIZE + (mid - 1)] = WHITE;
-    board[mid * BOARD_SIZE + (mid - 1)] = BLACK;
-    board[(mid - 1) * BOARD_SIZE + mid] = BLACK;
+    board = start_position();
 }
 
 /**
@@ -805,23 +2122,20 @@ void print_board(FILE *fp) {
     for (int i = 0; i < BOARD_SIZE; ++i) {
         fprintf(fp, "%d ", i); // Print row numbers
         for (int j = 0; j < BOARD_SIZE; ++j) {
-            if (board[i * BOARD_SIZE + j] == EMPTY) {
-                fprintf(fp, ". "); // Print a dot for empty spaces
-            } else if (board[i * BOARD_SIZE + j] == BLACK) {
+            Bitboard square = SQUARE_BIT(i * BOARD_SIZE + j);
+
+            if (board.player & square) {
                 fprintf(fp, "B "); // Print B for Black pieces
-            } else if (board[i * BOARD_SIZE + j] == WHITE) {
+            } else if (board.opponent & square) {
                 fprintf(fp, "W "); // Print W for White pieces
+            } else {
+                fprintf(fp, ". "); // Print a dot for empty spaces
             }
         }
         fprintf(fp, "\n");
     }
 }
 
-/**
- * Frees the memory allocated for the board.
- */
-void free_board(void) { free(board); }
-
 /**
  * Initialises the master process for communication with the IF wrapper and set
  * up the log file.
@@ -861,6 +2175,15 @@ int initialise_master(int argc, char *argv[], int *time_limit, int *my_colour,
     fprintf(*fp, "My name: %s\n", PLAYER_NAME_LOG);
     fprintf(*fp, "My colour: %d\n", *my_colour);
     fprintf(*fp, "Board size: %d\n", BOARD_SIZE);
+    fprintf(*fp, "Move kernel: %s\n", move_kernel_name);
+    fprintf(*fp, "Search: %s\n", SEARCH_MODE_NAMES[search_mode]);
+    fprintf(*fp, "Endgame solver: last %d empties\n", endgame_empties);
+    fprintf(*fp, "Proof search: up to %d empties, %ld nodes\n", proof_empties, proof_nodes);
+    fprintf(*fp, "Multi-ProbCut: %.2f sigma%s\n", mpc_threshold, MPC_FITTED ? "" : " (not fitted for this board)");
+    fprintf(*fp, "Late move reductions: after %d moves from depth %d, a ply more every %d\n",
+            lmr_moves, lmr_depth, lmr_step);
+    fprintf(*fp, "Pondering: %s\n", ponder_enabled ? "on" : "off");
+    fprintf(*fp, "Transposition table: %zu MB (%s)\n", transposition_table_size() >> 20, cache_memory_name);
     fprintf(*fp, "Time limit: %d\n", *time_limit);
     fprintf(*fp, "-----------------------------------\n");
     print_board(*fp);
@@ -870,54 +2193,28 @@ int initialise_master(int argc, char *argv[], int *time_limit, int *my_colour,
     return 1;
 }
 
-int evaluate_board_state(int my_player_colour) {
-    int my_player_pieces = 0;
-    int opponent_pieces = 0;
+int evaluate_board_state(Bitboard my_player_discs, Bitboard opponent_discs) {
+    int my_player_pieces = count_discs(my_player_discs);
+    int opponent_pieces = count_discs(opponent_discs);
 
-    int opponent_colour = (my_player_colour + 1) % 2;
-    
     int score = 0;
 
-    int my_player_edges = 0;
-    int opponent_edges = 0;
-
-    int my_player_corners = 0;
-    int opponent_corners = 0;
+    int my_player_edges = count_discs(my_player_discs & EDGE_SQUARES);
+    int opponent_edges = count_discs(opponent_discs & EDGE_SQUARES);
 
-    for (int i = 0; i < BOARD_SIZE; i++) {
-        for (int j = 0; j < BOARD_SIZE; j++) {
-            if (board[i * BOARD_SIZE + j] == my_player_colour) {
-                my_player_pieces++;
+    int my_player_corners = count_discs(my_player_discs & CORNER_SQUARES);
+    int opponent_corners = count_discs(opponent_discs & CORNER_SQUARES);
 
-                if ((i == 0 || i == BOARD_SIZE - 1) && (j == 0 || j == BOARD_SIZE - 1)) {
-                    my_player_corners++;
-                } else if (i == 0 || j == 0 || i == BOARD_SIZE - 1 || j == BOARD_SIZE - 1) {
-                    my_player_edges++;
-                }
-
-            } else if (board[i * BOARD_SIZE + j] == opponent_colour) {
-                opponent_pieces++;
-
-                if ((i == 0 || i == BOARD_SIZE - 1) && (j == 0 || j == BOARD_SIZE - 1)) {
-                    opponent_corners++;
-                } else if (i == 0 || j == 0 || i == BOARD_SIZE - 1 || j == BOARD_SIZE - 1) {
-                    opponent_edges++;
-                }
-
-            }
-        }
-    }
+    int my_player_stable = count_discs(get_stable_discs(my_player_discs, opponent_discs));
+    int opponent_stable = count_discs(get_stable_discs(opponent_discs, my_player_discs));
 
     int piece_score = my_player_pieces - opponent_pieces;
     int edge_score = my_player_edges - opponent_edges;
     int corner_score = my_player_corners - opponent_corners;
+    int stable_score = my_player_stable - opponent_stable;
 
-    int *my_player_moves = malloc(sizeof(int) * MAX_MOVES);
-    int *opponent_moves = malloc(sizeof(int) * MAX_MOVES);
-    int my_player_num_moves, opponent_num_moves;
-
-    legal_moves(my_player_moves, &my_player_num_moves, my_player_colour);
-    legal_moves(opponent_moves, &opponent_num_moves, opponent_colour);
+    int my_player_num_moves = count_discs(get_moves(my_player_discs, opponent_discs));
+    int opponent_num_moves = count_discs(get_moves(opponent_discs, my_player_discs));
 
     int move_score = my_player_num_moves - opponent_num_moves;
 
@@ -928,96 +2225,153 @@ int evaluate_board_state(int my_player_colour) {
         piece_score = piece_score * 0.1;
         edge_score = edge_score * 5;
         corner_score = corner_score * 25;
+        stable_score = stable_score * 10;
         move_score = move_score * 3;
     } else if (num_empty_spaces > 1 * num_spaces / 3) {
         piece_score = piece_score * 0.5;
         edge_score = edge_score * 3;
         corner_score = corner_score * 15;
+        stable_score = stable_score * 6;
         move_score = move_score * 2;
     } else {
         piece_score = piece_score * 2;
         edge_score = edge_score * 1.5;
         corner_score = corner_score * 10;
+        stable_score = stable_score * 3;
         move_score = move_score * 0.3;
     }
 
-    score = piece_score + edge_score + corner_score + move_score;
-
-    free(my_player_moves);
-    free(opponent_moves);
+    score = piece_score + edge_score + corner_score + stable_score + move_score;
 
     return score;
 }
 
-int evaluate_moves(int move, int player_colour, int depth, int alpha, int beta) {
-    fprintf(stderr, "evaluate_moves: Starting for move %d at depth %d\n", move, depth); // Debug point N
-    
-    int *board_copy = copy_curr_board();
-
-    make_temp_move(move, player_colour);
+/**
+ * Evaluates a leaf of the search from the perspective of the side to move.
+ * evaluate_board_state is antisymmetric, so the opponent's view of the same
+ * position is the negated score.
+ *
+ * @param pos position to evaluate, viewed from the side to move
+ * @return the evaluation for the side to move
+ */
+int evaluate_leaf(Position *pos) {
+    return evaluate_board_state(pos->player, pos->opponent);
+}
 
-    fprintf(stderr, "evaluate_moves: Calling minimax for move %d at depth %d\n", move, depth); // Debug point O
-   
-    int possible_score = minimax(depth - 1, alpha, beta, false, player_colour, (player_colour + 1) % 2);
-    
-    fprintf(stderr, "evaluate_moves: minimax returned %d for move %d\n", possible_score, move); // Debug point P
-    
-    restore_board(board_copy);
+int evaluate_moves(Position *pos, int move, int depth, int alpha, int beta, int guess, int first) {
+    search_stack[0].hash = hash_position(pos);
+    search_stack[0].side = 0;
 
-    return possible_score;
+    return search_root_move(pos, move, depth, alpha, beta, guess, first);
 }
 
-int make_temp_move(int temp_move, int player_colour) {
-    if (temp_move >= 0) {
-        make_move(temp_move, player_colour);
-        return 1;
-    }
+/**
+ * Reads every alpha update the master has sent so far. Updates for other
+ * searches are stale, left over from earlier moves, depths or windows, and
+ * are dropped; an update is only taken up while it stays below beta.
+ *
+ * @param search search the task belongs to
+ * @param alpha the task's lower bound
+ * @param beta the task's upper bound
+ * @return the highest alpha for the search
+ */
+int receive_alpha(int search, int alpha, int beta) {
+    MPI_Status status;
+    AlphaUpdate update;
+    int flag;
 
-    return 0;
+    for (;;) {
+        MPI_Iprobe(0, 5, MPI_COMM_WORLD, &flag, &status);
+
+        if (!flag) {
+            return alpha;
+        }
+
+        MPI_Recv(&update, sizeof(AlphaUpdate), MPI_BYTE, 0, 5, MPI_COMM_WORLD, &status);
+
+        if (update.search == search && update.alpha > alpha && update.alpha < beta) {
+            alpha = update.alpha;
+        }
+    }
 }
 
-int *copy_curr_board() {
-    int *curr_board_copy = malloc(sizeof(int) * BOARD_SIZE * BOARD_SIZE);
-    memcpy(curr_board_copy, board, sizeof(int) * BOARD_SIZE * BOARD_SIZE);
-    
-    return curr_board_copy;
+/**
+ * Plays a move for the side to move in the given position and hands the turn
+ * to the opponent. A negative move is a pass. The flipped discs are recorded
+ * in the given ply of the search stack so unmake_temp_move can take the move
+ * back without keeping a copy of the position, and the child's hash keys are
+ * set in the next frame.
+ *
+ * @param pos position to play the move in
+ * @param temp_move square to place the piece on, or -1 to pass
+ * @param ply search stack frame to record the move in
+ */
+void make_temp_move(Position *pos, int temp_move, int ply) {
+    SearchPly *frame = &search_stack[ply];
+
+    frame->move = temp_move;
+    frame->flips = play_move(pos, temp_move);
+
+    search_stack[ply + 1].hash = frame->hash;
+    hash_move(&search_stack[ply + 1].hash, temp_move, frame->flips);
+    search_stack[ply + 1].side = !frame->side;
+
+    /* start loading the child's bucket before its search probes it */
+    prefetch_transposition(search_stack[ply + 1].hash.key);
 }
 
-void restore_board(int *curr_board_copy) {
-    memcpy(board, curr_board_copy, sizeof(int) * BOARD_SIZE * BOARD_SIZE);
-    free(curr_board_copy);
+/**
+ * Takes back the move recorded in the given ply of the search stack.
+ *
+ * @param pos position the move was played in
+ * @param ply search stack frame the move was recorded in
+ */
+void unmake_temp_move(Position *pos, int ply) {
+    SearchPly *frame = &search_stack[ply];
+
+    undo_move(pos, frame->move, frame->flips);
 }
 
-int best_legal_move(int my_player_colour, int depth, int alpha, int beta, int time_limit) {
-    int *moves_available = malloc(sizeof(int) * MAX_MOVES);
+int best_legal_move(Position *pos, int depth, int alpha, int beta, int time_limit) {
+    int *moves_available = search_stack[0].moves;
     int number_of_moves;
 
-    legal_moves(moves_available, &number_of_moves, my_player_colour);
+    legal_moves(pos, moves_available, &number_of_moves);
 
     if (number_of_moves <= 0) {
-        free(moves_available);
         return -1;
     }
 
+    if (depth > 1) {
+        order_root_moves(moves_available, number_of_moves);
+    }
+
     int best_possible_move = moves_available[0];
     int best_possible_score = -9999999;
 
+    search_stack[0].hash = hash_position(pos);
+    search_stack[0].side = 0;
+
     for (int i = 0; i < number_of_moves; i++) {
         if (check_if_time_up()) {
             break;
         }
 
-        int *curr_board_copy = copy_curr_board();
+        int move = moves_available[i];
+        int score = search_root_move(pos, move, depth, alpha, beta, root_scores[move], i == 0);
 
-        make_temp_move(moves_available[i], my_player_colour);
-
-        int score = minimax(depth - 1, alpha, beta, false, my_player_colour, (my_player_colour + 1) % 2);
+        /* a search cut off by the deadline only returns a bound, which would
+           misorder the next iteration; the master drops the workers' stopped
+           results the same way */
+        if (check_if_time_up()) {
+            break;
+        }
 
-        restore_board(curr_board_copy);
+        root_scores[move] = score;
 
         if (score > best_possible_score) {
             best_possible_score = score;
-            best_possible_move = moves_available[i];
+            best_possible_move = move;
 
             if (alpha < best_possible_score) {
                 alpha = best_possible_score;
@@ -1025,29 +2379,25 @@ int best_legal_move(int my_player_colour, int depth, int alpha, int beta, int ti
         }
     }
 
-    free(moves_available);
-
     return best_possible_move;
 }
 
-int check_if_time_up() {
+int check_if_time_up(void) {
+    /* a pondering worker has no deadline of its own */
+    if (pondering) {
+        return ponder_stop_requested();
+    }
+
+    if (task_search != 0 && search_stop_requested()) {
+        return 1;
+    }
+
     clock_t curr_time = clock();
     double elapsed_time = ((double)(curr_time - start)) / CLOCKS_PER_SEC;
 
     return elapsed_time > (time_limit - 1.0);
 }
 
-int get_loc(char *movestring) {
-  if (movestring[0] == '-' && movestring[1] == '1') {
-    return -1; // Handle pass move
-  }
-  
-  int row, col; /* movestring of form "xy", x = row and y = column */
-  row = movestring[0] - '0';
-  col = movestring[1] - '0';
-  return (BOARD_SIZE * row) + col;
-}
-
 void terminate_workers() {
     int size;
     MPI_Comm_size(MPI_COMM_WORLD, &size);
@@ -0,0 +1,816 @@
+/************************************************************************
+ *
+ *  Grows an opening book by drop-out expansion, searching with every MPI
+ *  rank of my_player.
+ *
+ *  Usage: mpirun -np <ranks> expand_book [-d depth] [-p plies] [-x dropout]
+ *             [-n expansions] [-t seconds] [-c checkpoint] [-i interval]
+ *             [-o book_file]
+ *
+ *  The book is a tree of positions from the start position. Its leaves are
+ *  scored by a deep search from their parent, and expanding a leaf searches
+ *  every move from it to the given depth (12 by default), which scores its
+ *  children as new leaves and the leaf itself by the best of them. Scores
+ *  are backed up the tree by negamax.
+ *
+ *  Each round expands the leaves that are cheapest to reach from the start:
+ *  a path costs the sum, over its moves, of how far each falls short of the
+ *  best move where it is played, its drop-out. Leaves more than the given
+ *  drop-out (16 by default) away, or more than the given plies (16 by
+ *  default) from the start, are not expanded, so the book grows along the
+ *  lines that good play can reach and stops by itself. -n stops the run
+ *  after that many expansions.
+ *
+ *  Rank 0 runs the expansion as my_player's master does its search: every
+ *  move to search is a task for run_worker, which the other ranks run
+ *  unchanged, with -t seconds at most per move. A single rank searches by
+ *  itself. A leaf with a move that runs out of time stays a leaf, and the
+ *  move is searched again when the leaf is next chosen; a round in which
+ *  every search runs out of time and no leaf is expanded stops the run.
+ *
+ *  The tree is saved to the checkpoint file (expand_book.ckpt by default)
+ *  every -i seconds (300 by default) and at the end, and a run given an
+ *  existing checkpoint carries on from it. Every checkpoint also writes the
+ *  book (opening.book by default): the best move and score of every
+ *  expanded position.
+ *
+ ************************************************************************/
+#define PLAYER_NO_MAIN
+#include "../src/my_player.c"
+#include <limits.h>
+
+#define CHECKPOINT_MAGIC "OTHEXPD1"
+
+/* what a book node is: a leaf to expand, a position whose moves have all
+   been searched, or a finished game */
+#define NODE_LEAF 0
+#define NODE_EXPANDED 1
+#define NODE_FINAL 2
+
+/*
+ * A position of the book tree. The score is for the side to move, from a
+ * search of the given depth, or backed up from the children once expanded.
+ * The ply is the fewest moves it is reached in from the start.
+ */
+typedef struct {
+    Position pos;
+    int32_t score;
+    int32_t move;
+    int32_t depth;
+    int32_t ply;
+    int32_t state;
+    int32_t dropout;
+} BookNode;
+
+/* the checkpoint file header; the nodes follow it */
+typedef struct {
+    char magic[8];
+    uint32_t board_size;
+    uint32_t node_size;
+    uint64_t count;
+} CheckpointHeader;
+
+/* a move to search for a round: from which node, how deep, and its result */
+typedef struct {
+    int node;
+    int move;
+    int depth;
+    int score;
+    int stopped;
+} ExpandTask;
+
+/* the nodes, and an open-addressing index from position keys to them */
+BookNode *nodes = NULL;
+int node_count = 0;
+int node_capacity = 0;
+int *node_index = NULL;
+int index_size = 0;
+
+int find_node(uint64_t);
+int add_node(Position *, int);
+void rebuild_index(void);
+int child_moves(Position *, int *);
+void back_up_tree(void);
+void back_up_scores(int, char *);
+void find_dropouts(int, int);
+int choose_leaves(int *, int, int, int, int);
+int expand_leaves(int *, int, int, double, int *);
+void search_tasks(ExpandTask *, int, double);
+void send_task(int, ExpandTask *, double);
+void end_round(int);
+int save_checkpoint(const char *, const char *);
+int load_checkpoint(const char *);
+
+int main(int argc, char *argv[]) {
+    const char *checkpoint = "expand_book.ckpt";
+    const char *output = "opening.book";
+    int depth = 12;
+    int max_plies = 16;
+    int max_dropout = 16;
+    int max_expansions = 0;
+    double task_seconds = 600;
+    double interval = 300;
+    int rank, size;
+
+    MPI_Init(&argc, &argv);
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+    MPI_Comm_size(MPI_COMM_WORLD, &size);
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-d") == 0 && i + 1 < argc) {
+            depth = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "-p") == 0 && i + 1 < argc) {
+            max_plies = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "-x") == 0 && i + 1 < argc) {
+            max_dropout = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "-n") == 0 && i + 1 < argc) {
+            max_expansions = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "-t") == 0 && i + 1 < argc) {
+            task_seconds = atof(argv[++i]);
+        } else if (strcmp(argv[i], "-c") == 0 && i + 1 < argc) {
+            checkpoint = argv[++i];
+        } else if (strcmp(argv[i], "-i") == 0 && i + 1 < argc) {
+            interval = atof(argv[++i]);
+        } else if (strcmp(argv[i], "-o") == 0 && i + 1 < argc) {
+            output = argv[++i];
+        } else {
+            if (rank == 0) {
+                printf("Usage: %s [-d depth] [-p plies] [-x dropout] [-n expansions] [-t seconds]"
+                       " [-c checkpoint] [-i interval] [-o book_file]\n", argv[0]);
+            }
+            MPI_Finalize();
+            return 1;
+        }
+    }
+
+    /* every rank sets up its search as my_player does */
+    select_move_kernel();
+    read_search_settings();
+    clear_move_ordering();
+
+    if (!init_transposition_table(transposition_megabytes(1, argv))) {
+        fprintf(stderr, "Rank %d: could not allocate the transposition table\n", rank);
+    }
+
+    if (rank != 0) {
+        run_worker(rank);
+        MPI_Finalize();
+        return 0;
+    }
+
+    if (depth < 1 || depth > MAX_PLY) {
+        printf("Depth must be between 1 and %d\n", MAX_PLY);
+        terminate_workers();
+        MPI_Finalize();
+        return 1;
+    }
+
+    if (load_checkpoint(checkpoint)) {
+        printf("Resuming from %s: %d positions\n", checkpoint, node_count);
+    } else {
+        Position start_pos = start_position();
+
+        add_node(&start_pos, 0);
+    }
+
+    int *leaves = NULL;
+    int expansions = 0;
+    time_t last_checkpoint = time(NULL);
+
+    for (int round = 1; max_expansions <= 0 || expansions < max_expansions; round++) {
+        /* back up the scores and cost every path before choosing */
+        leaves = realloc(leaves, node_capacity * sizeof(int));
+
+        if (leaves == NULL) {
+            printf("Out of memory\n");
+            MPI_Abort(MPI_COMM_WORLD, 1);
+        }
+
+        back_up_tree();
+
+        for (int i = 0; i < node_count; i++) {
+            nodes[i].dropout = INT_MAX;
+        }
+        find_dropouts(0, 0);
+
+        int limit = (max_expansions > 0) ? max_expansions - expansions : node_count;
+        int count = choose_leaves(leaves, limit, size - 1, max_plies, max_dropout);
+
+        if (count == 0) {
+            printf("No leaf within %d plies and a drop-out of %d is left\n", max_plies, max_dropout);
+            break;
+        }
+
+        int finished;
+        int expanded = expand_leaves(leaves, count, depth, task_seconds, &finished);
+        expansions += expanded;
+
+        end_round(size);
+
+        back_up_tree();
+
+        printf("Round %d: expanded %d positions, %d in the tree, start position scores %d\n",
+               round, expanded, node_count, nodes[0].score);
+        fflush(stdout);
+
+        if (expanded == 0 && finished == 0) {
+            printf("No search finished within %g seconds per move\n", task_seconds);
+            break;
+        }
+
+        if (difftime(time(NULL), last_checkpoint) >= interval) {
+            save_checkpoint(checkpoint, output);
+            last_checkpoint = time(NULL);
+        }
+    }
+
+    if (save_checkpoint(checkpoint, output)) {
+        printf("Saved %d positions to %s and the book to %s\n", node_count, checkpoint, output);
+    }
+
+    free(leaves);
+    terminate_workers();
+    MPI_Finalize();
+    return 0;
+}
+
+/**
+ * Finds the node of a position.
+ *
+ * @param key hash key of the position
+ * @return the node's index, or -1 if the position is not in the tree
+ */
+int find_node(uint64_t key) {
+    for (int slot = (int)(key & (uint64_t)(index_size - 1)); index_size > 0 && node_index[slot] >= 0;
+         slot = (slot + 1) & (index_size - 1)) {
+        if (hash_position(&nodes[node_index[slot]].pos).key == key) {
+            return node_index[slot];
+        }
+    }
+
+    return -1;
+}
+
+/**
+ * Adds a position to the tree as a leaf with no score yet, depth -1, or a
+ * finished game with its final score. The arrays grow as needed.
+ *
+ * @param pos position to add, viewed from the side to move
+ * @param ply moves from the start to it
+ * @return the new node's index
+ */
+int add_node(Position *pos, int ply) {
+    if (node_count == node_capacity) {
+        node_capacity = (node_capacity > 0) ? node_capacity * 2 : 1024;
+        nodes = realloc(nodes, node_capacity * sizeof(BookNode));
+
+        if (nodes == NULL) {
+            printf("Out of memory\n");
+            MPI_Abort(MPI_COMM_WORLD, 1);
+        }
+    }
+
+    BookNode *node = &nodes[node_count++];
+
+    memset(node, 0, sizeof(*node));
+    node->pos = *pos;
+    node->move = -1;
+    node->ply = ply;
+    node->depth = -1;
+    node->state = NODE_LEAF;
+
+    if (get_moves(pos->player, pos->opponent) == 0 && get_moves(pos->opponent, pos->player) == 0) {
+        node->state = NODE_FINAL;
+        node->score = count_discs(pos->player) - count_discs(pos->opponent);
+        node->depth = SOLVE_DEPTH;
+    }
+
+    /* keep the index at most half full */
+    if (2 * node_count > index_size) {
+        rebuild_index();
+    } else {
+        int slot = (int)(hash_position(pos).key & (uint64_t)(index_size - 1));
+
+        while (node_index[slot] >= 0) {
+            slot = (slot + 1) & (index_size - 1);
+        }
+        node_index[slot] = node_count - 1;
+    }
+
+    return node_count - 1;
+}
+
+/**
+ * Rebuilds the key index with room for four times the nodes.
+ */
+void rebuild_index(void) {
+    free(node_index);
+
+    for (index_size = 1024; index_size < 4 * node_count; index_size *= 2) {
+    }
+
+    node_index = malloc(index_size * sizeof(int));
+
+    if (node_index == NULL) {
+        printf("Out of memory\n");
+        MPI_Abort(MPI_COMM_WORLD, 1);
+    }
+
+    memset(node_index, -1, index_size * sizeof(int));
+
+    for (int i = 0; i < node_count; i++) {
+        int slot = (int)(hash_position(&nodes[i].pos).key & (uint64_t)(index_size - 1));
+
+        while (node_index[slot] >= 0) {
+            slot = (slot + 1) & (index_size - 1);
+        }
+        node_index[slot] = i;
+    }
+}
+
+/**
+ * Lists the moves of a position: its legal moves, or a pass when only the
+ * opponent can move.
+ *
+ * @param pos position, viewed from the side to move
+ * @param moves receives the moves
+ * @return number of moves, 0 if the game is over
+ */
+int child_moves(Position *pos, int *moves) {
+    int number_of_moves;
+
+    legal_moves(pos, moves, &number_of_moves);
+
+    if (number_of_moves > 0) {
+        return number_of_moves;
+    }
+
+    if (get_moves(pos->opponent, pos->player) != 0) {
+        moves[0] = -1;
+        return 1;
+    }
+
+    return 0;
+}
+
+/**
+ * Backs the scores up the whole tree from the start position.
+ */
+void back_up_tree(void) {
+    char *visited = calloc(node_count, 1);
+
+    if (visited == NULL) {
+        printf("Out of memory\n");
+        MPI_Abort(MPI_COMM_WORLD, 1);
+    }
+
+    back_up_scores(0, visited);
+    free(visited);
+}
+
+/**
+ * Backs the scores of expanded nodes up from their children by negamax,
+ * each node once, and sets their best moves.
+ *
+ * @param node node to back up from
+ * @param visited marks for the nodes already backed up this pass
+ */
+void back_up_scores(int node, char *visited) {
+    int moves[MAX_MOVES];
+
+    if (visited[node] || nodes[node].state != NODE_EXPANDED) {
+        return;
+    }
+    visited[node] = 1;
+
+    int number_of_moves = child_moves(&nodes[node].pos, moves);
+    int best = INT_MIN;
+
+    for (int i = 0; i < number_of_moves; i++) {
+        Position child = nodes[node].pos;
+
+        play_move(&child, moves[i]);
+        int index = find_node(hash_position(&child).key);
+
+        back_up_scores(index, visited);
+
+        if (-nodes[index].score > best) {
+            best = -nodes[index].score;
+            nodes[node].move = moves[i];
+            nodes[node].depth = nodes[index].depth + 1;
+        }
+    }
+
+    nodes[node].score = best;
+}
+
+/**
+ * Finds the cheapest drop-out of every node reachable from the given one:
+ * what the moves on the way give up against the best move where they are
+ * played, summed, on the cheapest path.
+ *
+ * @param node node to start from
+ * @param dropout drop-out of the path to it
+ */
+void find_dropouts(int node, int dropout) {
+    int moves[MAX_MOVES];
+
+    if (dropout >= nodes[node].dropout) {
+        return;
+    }
+    nodes[node].dropout = dropout;
+
+    if (nodes[node].state != NODE_EXPANDED) {
+        return;
+    }
+
+    int number_of_moves = child_moves(&nodes[node].pos, moves);
+
+    for (int i = 0; i < number_of_moves; i++) {
+        Position child = nodes[node].pos;
+
+        play_move(&child, moves[i]);
+        int index = find_node(hash_position(&child).key);
+
+        find_dropouts(index, dropout + nodes[node].score + nodes[index].score);
+    }
+}
+
+/**
+ * Chooses the leaves to expand this round: the cheapest to reach within the
+ * limits, as many as keep the workers busy.
+ *
+ * @param leaves receives the leaves chosen
+ * @param limit most leaves to choose
+ * @param workers number of worker ranks
+ * @param max_plies deepest ply a leaf may be at
+ * @param max_dropout highest drop-out a leaf may have
+ * @return number of leaves chosen
+ */
+int choose_leaves(int *leaves, int limit, int workers, int max_plies, int max_dropout) {
+    int moves[MAX_MOVES];
+    int count = 0;
+    int tasks = 0;
+
+    /* select the cheapest leaf again and again; rounds are few and long */
+    while (count < limit && tasks < 2 * workers + 1) {
+        int best = -1;
+
+        for (int i = 0; i < node_count; i++) {
+            BookNode *node = &nodes[i];
+
+            if (node->state != NODE_LEAF || node->ply >= max_plies || node->dropout > max_dropout) {
+                continue;
+            }
+
+            if (best < 0 || node->dropout < nodes[best].dropout ||
+                (node->dropout == nodes[best].dropout && node->ply < nodes[best].ply)) {
+                best = i;
+            }
+        }
+
+        if (best < 0) {
+            break;
+        }
+
+        /* taken out of the running until the round expands it */
+        nodes[best].state = NODE_EXPANDED;
+        leaves[count++] = best;
+        tasks += child_moves(&nodes[best].pos, moves);
+    }
+
+    for (int i = 0; i < count; i++) {
+        nodes[leaves[i]].state = NODE_LEAF;
+    }
+
+    return count;
+}
+
+
+/**
+ * Searches every move of the given leaves, scores their children from the
+ * searches and marks the leaves expanded. Children already in the tree keep
+ * their scores unless this search is deeper, and finished games are scored
+ * without a search. A leaf with a move whose search ran out of time stays a
+ * leaf, so the move is searched again when the leaf is next chosen.
+ *
+ * @param leaves leaves to expand
+ * @param count number of leaves
+ * @param depth depth to search every move to
+ * @param seconds most time a worker may spend on one move
+ * @param finished receives the number of searches that did not run out of
+ *        time
+ * @return number of leaves expanded
+ */
+int expand_leaves(int *leaves, int count, int depth, double seconds, int *finished) {
+    ExpandTask *tasks = malloc(count * MAX_MOVES * sizeof(ExpandTask));
+    int moves[MAX_MOVES];
+    int number_of_tasks = 0;
+    int expanded = 0;
+    int stopped = 0;
+
+    if (tasks == NULL) {
+        printf("Out of memory\n");
+        MPI_Abort(MPI_COMM_WORLD, 1);
+    }
+
+    for (int i = 0; i < count; i++) {
+        int number_of_moves = child_moves(&nodes[leaves[i]].pos, moves);
+        int empties = BOARD_SQUARES - count_discs(nodes[leaves[i]].pos.player | nodes[leaves[i]].pos.opponent);
+
+        for (int j = 0; j < number_of_moves; j++) {
+            Position child = nodes[leaves[i]].pos;
+            int ply = nodes[leaves[i]].ply + 1;
+
+            play_move(&child, moves[j]);
+            int index = find_node(hash_position(&child).key);
+
+            if (index < 0) {
+                index = add_node(&child, ply);
+            } else if (ply < nodes[index].ply) {
+                nodes[index].ply = ply;
+            }
+
+            /* searches that reach the end of the game solve it instead */
+            ExpandTask task = {leaves[i], moves[j], (depth >= empties) ? SOLVE_DEPTH : depth, 0, 0};
+            int child_depth = (task.depth == SOLVE_DEPTH) ? SOLVE_DEPTH : task.depth - 1;
+
+            if (nodes[index].state == NODE_LEAF && nodes[index].depth < child_depth) {
+                tasks[number_of_tasks++] = task;
+            }
+        }
+    }
+
+    search_tasks(tasks, number_of_tasks, seconds);
+
+    for (int i = 0; i < count; i++) {
+        nodes[leaves[i]].state = NODE_EXPANDED;
+    }
+
+    for (int i = 0; i < number_of_tasks; i++) {
+        Position child = nodes[tasks[i].node].pos;
+
+        play_move(&child, tasks[i].move);
+        BookNode *node = &nodes[find_node(hash_position(&child).key)];
+
+        /* a search cut short by the deadline has no score to trust, so the
+           child keeps the one it had and its parent stays a leaf */
+        if (tasks[i].stopped) {
+            nodes[tasks[i].node].state = NODE_LEAF;
+            stopped++;
+        } else {
+            node->score = -tasks[i].score;
+            node->depth = (tasks[i].depth == SOLVE_DEPTH) ? SOLVE_DEPTH : tasks[i].depth - 1;
+        }
+    }
+
+    for (int i = 0; i < count; i++) {
+        expanded += (nodes[leaves[i]].state == NODE_EXPANDED);
+    }
+
+    *finished = number_of_tasks - stopped;
+
+    if (stopped > 0) {
+        printf("%d of %d searches ran out of time; %d positions are left to expand again\n", stopped,
+               number_of_tasks, count - expanded);
+    }
+
+    free(tasks);
+    return expanded;
+}
+
+/**
+ * Searches the moves of a round. With workers, each is sent one move at a
+ * time through run_worker's protocol and the next as soon as it answers, so
+ * slow moves do not hold up the others; alone, rank 0 searches them itself.
+ *
+ * @param tasks moves to search, receiving their scores
+ * @param count number of moves
+ * @param seconds most time a worker may spend on one move
+ */
+void search_tasks(ExpandTask *tasks, int count, double seconds) {
+    int size;
+
+    MPI_Comm_size(MPI_COMM_WORLD, &size);
+
+    if (size == 1) {
+        for (int i = 0; i < count; i++) {
+            start = clock();
+            time_limit = seconds;
+
+            tasks[i].score = evaluate_moves(&nodes[tasks[i].node].pos, tasks[i].move, tasks[i].depth,
+                                            -SCORE_INFINITY, SCORE_INFINITY, 0, 1);
+            tasks[i].stopped = check_if_time_up();
+        }
+        return;
+    }
+
+    int *working_on = malloc(size * sizeof(int));
+    int sent = 0;
+
+    if (working_on == NULL) {
+        printf("Out of memory\n");
+        MPI_Abort(MPI_COMM_WORLD, 1);
+    }
+
+    for (int worker = 1; worker < size; worker++) {
+        working_on[worker] = -1;
+
+        if (sent < count) {
+            send_task(worker, &tasks[sent], seconds);
+            working_on[worker] = sent++;
+        }
+    }
+
+    for (int done = 0; done < count; done++) {
+        MPI_Status status;
+        MoveResult result;
+        int number_of_results;
+
+        MPI_Recv(&number_of_results, 1, MPI_INT, MPI_ANY_SOURCE, 3, MPI_COMM_WORLD, &status);
+        MPI_Recv(&result, sizeof(MoveResult), MPI_BYTE, status.MPI_SOURCE, 4, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+
+        ExpandTask *task = &tasks[working_on[status.MPI_SOURCE]];
+
+        task->score = result.score;
+        task->stopped = result.stopped;
+        working_on[status.MPI_SOURCE] = -1;
+
+        /* the freed worker takes the next move */
+        if (sent < count) {
+            send_task(status.MPI_SOURCE, &tasks[sent], seconds);
+            working_on[status.MPI_SOURCE] = sent++;
+        }
+    }
+
+    free(working_on);
+}
+
+/**
+ * Sends one move to a worker as a batch of one, searched with the full
+ * window so the score is exact.
+ *
+ * @param worker rank of the worker
+ * @param task move to search
+ * @param seconds most time the worker may spend on it
+ */
+void send_task(int worker, ExpandTask *task, double seconds) {
+    int number_of_moves = 1;
+    int command = 0;
+    MoveTask move_task;
+
+    memset(&move_task, 0, sizeof(move_task));
+    move_task.position = nodes[task->node].pos;
+    move_task.move = task->move;
+    move_task.depth = task->depth;
+    move_task.alpha = -SCORE_INFINITY;
+    move_task.beta = SCORE_INFINITY;
+    move_task.time_limit = seconds;
+
+    MPI_Send(&number_of_moves, 1, MPI_INT, worker, 0, MPI_COMM_WORLD);
+    MPI_Send(&command, 1, MPI_INT, worker, 1, MPI_COMM_WORLD);
+    MPI_Send(&move_task, sizeof(MoveTask), MPI_BYTE, worker, 2, MPI_COMM_WORLD);
+}
+
+/**
+ * Ages the transposition table and move ordering of every rank after a
+ * round, as my_player does after every move, so entries from early rounds
+ * do not hold their slots for the whole run. The workers are sent the same
+ * empty batch minimax_strategy sends them.
+ *
+ * @param size number of ranks
+ */
+void end_round(int size) {
+    int zero_moves = 0;
+    int command = 0;
+
+    for (int worker = 1; worker < size; worker++) {
+        MPI_Send(&zero_moves, 1, MPI_INT, worker, 0, MPI_COMM_WORLD);
+        MPI_Send(&command, 1, MPI_INT, worker, 1, MPI_COMM_WORLD);
+    }
+
+    age_transposition_table();
+    age_move_ordering();
+}
+
+/**
+ * Saves the tree to the checkpoint file and writes the book of its expanded
+ * positions. Both are written to a temporary file first and renamed over the
+ * old one, so an interrupted run leaves the last checkpoint whole.
+ *
+ * @param path checkpoint file
+ * @param book_path book file
+ * @return 1 if both were written, 0 on an error
+ */
+int save_checkpoint(const char *path, const char *book_path) {
+    char *temporary = malloc(strlen(path) + strlen(book_path) + 5);
+    CheckpointHeader header;
+    FILE *file;
+    int written;
+
+    if (temporary == NULL) {
+        printf("Out of memory\n");
+        MPI_Abort(MPI_COMM_WORLD, 1);
+    }
+
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, CHECKPOINT_MAGIC, sizeof(header.magic));
+    header.board_size = BOARD_SIZE;
+    header.node_size = sizeof(BookNode);
+    header.count = (uint64_t)node_count;
+
+    sprintf(temporary, "%s.tmp", path);
+
+    if ((file = fopen(temporary, "wb")) == NULL) {
+        printf("Could not write %s\n", temporary);
+        free(temporary);
+        return 0;
+    }
+
+    written = fwrite(&header, sizeof(header), 1, file) == 1 &&
+              fwrite(nodes, sizeof(BookNode), node_count, file) == (size_t)node_count;
+
+    if (fclose(file) != 0 || !written || rename(temporary, path) != 0) {
+        printf("Could not write %s\n", path);
+        free(temporary);
+        return 0;
+    }
+
+    BookEntry *entries = malloc((node_count + 1) * sizeof(BookEntry));
+    size_t count = 0;
+
+    if (entries == NULL) {
+        printf("Out of memory\n");
+        MPI_Abort(MPI_COMM_WORLD, 1);
+    }
+
+    for (int i = 0; i < node_count; i++) {
+        BookNode *node = &nodes[i];
+
+        if (node->state != NODE_EXPANDED || node->move < 0) {
+            continue;
+        }
+
+        BookEntry entry = {hash_position(&node->pos).key, 0, (int8_t)node->move,
+                           (uint8_t)(node->depth < 255 ? node->depth : 255), 0};
+
+        entry.score = (int16_t)(node->score > INT16_MAX ? INT16_MAX
+                                : node->score < -INT16_MAX ? -INT16_MAX : node->score);
+        entries[count++] = entry;
+    }
+
+    sprintf(temporary, "%s.tmp", book_path);
+
+    written = write_book(temporary, entries, count) && rename(temporary, book_path) == 0;
+
+    if (!written) {
+        printf("Could not write %s\n", book_path);
+    }
+
+    free(entries);
+    free(temporary);
+    return written;
+}
+
+/**
+ * Loads the tree from a checkpoint file written by save_checkpoint for this
+ * board size.
+ *
+ * @param path checkpoint file
+ * @return 1 if the tree was loaded, 0 if there is no valid checkpoint
+ */
+int load_checkpoint(const char *path) {
+    CheckpointHeader header;
+    FILE *file = fopen(path, "rb");
+
+    if (file == NULL) {
+        return 0;
+    }
+
+    if (fread(&header, sizeof(header), 1, file) != 1 ||
+        memcmp(header.magic, CHECKPOINT_MAGIC, sizeof(header.magic)) != 0 ||
+        header.board_size != BOARD_SIZE || header.node_size != sizeof(BookNode) || header.count == 0) {
+        printf("%s is not a checkpoint of this board size, starting afresh\n", path);
+        fclose(file);
+        return 0;
+    }
+
+    for (node_capacity = 1024; node_capacity < (int)header.count; node_capacity *= 2) {
+    }
+
+    nodes = malloc(node_capacity * sizeof(BookNode));
+
+    if (nodes == NULL || fread(nodes, sizeof(BookNode), header.count, file) != header.count) {
+        printf("Could not read %s, starting afresh\n", path);
+        fclose(file);
+        free(nodes);
+        nodes = NULL;
+        node_capacity = 0;
+        return 0;
+    }
+
+    fclose(file);
+    node_count = (int)header.count;
+    rebuild_index();
+    return 1;
+}
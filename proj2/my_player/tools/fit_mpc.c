@@ -0,0 +1,265 @@
+/************************************************************************
+ *
+ *  Fits the Multi-ProbCut parameters of my_player and prints them as
+ *  mpc_params.h.
+ *
+ *  Usage: fit_mpc [-g games] [-s seed] > ../src/mpc_params.h
+ *
+ *  The positions come from games the engine plays against itself: a few
+ *  random moves to spread the openings, then depth-3 searches with the odd
+ *  random move. Every few plies the position is searched to every depth up
+ *  to MPC_MAX_DEPTH with the full window, and for each depth the deep score
+ *  is fitted against the score of its shallow search, per game phase, by
+ *  least squares: deep = slope * shallow + offset, with sigma the standard
+ *  deviation of the misses.
+ *
+ *  The shallow search of a depth is about half as deep, of the same parity
+ *  since scores swing between odd and even depths. The searches run with
+ *  Multi-ProbCut off, so the fit does not feed on itself, and with late
+ *  move reductions off, so the pairs are of full-width searches. Each
+ *  search starts on an empty transposition table, so a shallow score is
+ *  not the deep one read back from the table.
+ *
+ ************************************************************************/
+#define PLAYER_NO_MAIN
+#include "../src/my_player.c"
+#include <math.h>
+
+/* depths fitted, and the fewest samples a fit is trusted with */
+#define FIT_MIN_DEPTH 3
+#define FIT_MAX_DEPTH 8
+#define MIN_SAMPLES 30
+
+/* random opening moves, the chance of a random move after them, and the
+   plies between samples */
+#define RANDOM_PLIES 8
+#define RANDOM_MOVE_ODDS 8
+#define SAMPLE_EVERY 3
+
+/* positions with no more empties than this are not sampled, as their deep
+   searches would mostly reach the end of the game */
+#define FIT_MIN_EMPTIES FIT_MAX_DEPTH
+
+#define FIT_PHASES 4
+
+typedef struct {
+    double n, x, y, xx, xy, yy;
+} FitSums;
+
+int shallow_depth(int);
+int search_position(Position *, int);
+int random_move(Bitboard, uint64_t *);
+void play_fit_game(FitSums [FIT_PHASES][FIT_MAX_DEPTH + 1], uint64_t *);
+void print_params(FitSums [FIT_PHASES][FIT_MAX_DEPTH + 1], int, uint64_t);
+
+int main(int argc, char *argv[]) {
+    FitSums sums[FIT_PHASES][FIT_MAX_DEPTH + 1];
+    int games = 200;
+    uint64_t seed = 1;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-g") == 0 && i + 1 < argc) {
+            games = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "-s") == 0 && i + 1 < argc) {
+            seed = strtoull(argv[++i], NULL, 10);
+        } else {
+            fprintf(stderr, "Usage: %s [-g games] [-s seed]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    select_move_kernel();
+    clear_move_ordering();
+
+    if (!init_transposition_table(TT_MEGABYTES)) {
+        fprintf(stderr, "Could not allocate the transposition table\n");
+        return 1;
+    }
+
+    /* no deadline, no cuts from an earlier fit and no reductions */
+    start = clock();
+    time_limit = NO_TIME_LIMIT;
+    mpc_threshold = 0;
+    lmr_moves = 0;
+
+    memset(sums, 0, sizeof(sums));
+
+    uint64_t state = seed;
+
+    for (int game = 0; game < games; game++) {
+        play_fit_game(sums, &state);
+        fprintf(stderr, "Game %d of %d done\n", game + 1, games);
+    }
+
+    print_params(sums, games, seed);
+    return 0;
+}
+
+/**
+ * Returns the depth of the shallow search paired with a deep one: half the
+ * depth, lowered by one where needed to keep the parity.
+ *
+ * @param depth depth of the deep search
+ * @return depth of the shallow search
+ */
+int shallow_depth(int depth) {
+    int shallow = depth / 2;
+
+    return ((depth - shallow) % 2 == 0) ? shallow : shallow - 1;
+}
+
+/**
+ * Searches a position with the full window, on a cleared transposition
+ * table so the entries of deeper searches do not stand in for its result.
+ *
+ * @param pos position to search, viewed from the side to move
+ * @param depth depth to search to
+ * @return the score for the side to move
+ */
+int search_position(Position *pos, int depth) {
+    clear_transposition_table();
+    search_stack[0].hash = hash_position(pos);
+    search_stack[0].side = 0;
+
+    return negamax(pos, 0, depth, -SCORE_INFINITY, SCORE_INFINITY);
+}
+
+/**
+ * Picks one of the given moves at random.
+ *
+ * @param moves bitboard of legal moves, not empty
+ * @param state xorshift generator state
+ * @return the move picked
+ */
+int random_move(Bitboard moves, uint64_t *state) {
+    *state ^= *state << 13;
+    *state ^= *state >> 7;
+    *state ^= *state << 17;
+
+    for (int skip = (int)(*state % (uint64_t)count_discs(moves)); skip > 0; skip--) {
+        moves &= moves - 1;
+    }
+
+    return first_square(moves);
+}
+
+/**
+ * Plays one game of the engine against itself and adds the scores of the
+ * sampled positions to the sums.
+ *
+ * @param sums regression sums by phase and deep depth
+ * @param state random generator state
+ */
+void play_fit_game(FitSums sums[FIT_PHASES][FIT_MAX_DEPTH + 1], uint64_t *state) {
+    Position pos = start_position();
+
+    for (int ply = 0;; ply++) {
+        Bitboard moves = get_moves(pos.player, pos.opponent);
+        int empties = BOARD_SQUARES - count_discs(pos.player | pos.opponent);
+        int move;
+
+        if (moves == 0) {
+            if (get_moves(pos.opponent, pos.player) == 0) {
+                return;
+            }
+
+            play_move(&pos, -1);
+            continue;
+        }
+
+        if (ply >= RANDOM_PLIES && ply % SAMPLE_EVERY == 0 && empties > FIT_MIN_EMPTIES) {
+            int scores[FIT_MAX_DEPTH + 1];
+            int phase = (BOARD_SQUARES - 4 - empties) * FIT_PHASES / (BOARD_SQUARES - 3);
+
+            for (int depth = 1; depth <= FIT_MAX_DEPTH; depth++) {
+                scores[depth] = search_position(&pos, depth);
+            }
+
+            for (int depth = FIT_MIN_DEPTH; depth <= FIT_MAX_DEPTH; depth++) {
+                FitSums *fit = &sums[phase][depth];
+                double x = scores[shallow_depth(depth)];
+                double y = scores[depth];
+
+                fit->n += 1;
+                fit->x += x;
+                fit->y += y;
+                fit->xx += x * x;
+                fit->xy += x * y;
+                fit->yy += y * y;
+            }
+        }
+
+        if (ply < RANDOM_PLIES || random_move(FULL_BOARD, state) % RANDOM_MOVE_ODDS == 0) {
+            move = random_move(moves, state);
+        } else {
+            move = best_legal_move(&pos, 3, -SCORE_INFINITY, SCORE_INFINITY, 0);
+        }
+
+        play_move(&pos, move);
+    }
+}
+
+/**
+ * Prints the fitted parameters as a C header. Depths and phases with too
+ * few samples get a zero slope, which turns Multi-ProbCut off for them.
+ *
+ * @param sums regression sums by phase and deep depth
+ * @param games number of games the positions came from
+ * @param seed random seed of the games
+ */
+void print_params(FitSums sums[FIT_PHASES][FIT_MAX_DEPTH + 1], int games, uint64_t seed) {
+    printf("/* Generated by fit_mpc from %d games with seed %llu, do not edit. */\n",
+           games, (unsigned long long)seed);
+    printf("#ifndef MPC_PARAMS_H\n#define MPC_PARAMS_H\n\n");
+    printf("/* board size the parameters were fitted on, game phases and deep depths */\n");
+    printf("#define MPC_BOARD_SIZE %d\n", BOARD_SIZE);
+    printf("#define MPC_PHASES %d\n", FIT_PHASES);
+    printf("#define MPC_MIN_DEPTH %d\n", FIT_MIN_DEPTH);
+    printf("#define MPC_MAX_DEPTH %d\n\n", FIT_MAX_DEPTH);
+    printf("/*\n");
+    printf(" * Fit of a deep search score against the score of a shallow search of the\n");
+    printf(" * same position: deep = slope * shallow + offset, missing by sigma on\n");
+    printf(" * average. A zero slope means there is no fit.\n");
+    printf(" */\n");
+    printf("typedef struct {\n");
+    printf("    int shallow;\n");
+    printf("    double slope;\n");
+    printf("    double offset;\n");
+    printf("    double sigma;\n");
+    printf("} MpcParams;\n\n");
+    printf("static const MpcParams MPC_PARAMS[MPC_PHASES][MPC_MAX_DEPTH + 1] = {\n");
+
+    for (int phase = 0; phase < FIT_PHASES; phase++) {
+        printf("    {\n");
+
+        for (int depth = 0; depth <= FIT_MAX_DEPTH; depth++) {
+            FitSums *fit = &sums[phase][depth];
+            double slope = 0, offset = 0, sigma = 0;
+            int shallow = (depth >= FIT_MIN_DEPTH) ? shallow_depth(depth) : 0;
+
+            if (depth >= FIT_MIN_DEPTH && fit->n >= MIN_SAMPLES) {
+                double var_x = fit->xx - fit->x * fit->x / fit->n;
+                double cov = fit->xy - fit->x * fit->y / fit->n;
+
+                if (var_x > 0) {
+                    slope = cov / var_x;
+                    offset = (fit->y - slope * fit->x) / fit->n;
+
+                    /* residual sum of squares, over n - 2 for the two fitted values */
+                    double residual = fit->yy - 2 * slope * fit->xy - 2 * offset * fit->y +
+                                      slope * slope * fit->xx + 2 * slope * offset * fit->x +
+                                      offset * offset * fit->n;
+
+                    sigma = sqrt((residual > 0 ? residual : 0) / (fit->n - 2));
+                }
+            }
+
+            printf("        {%d, %.4f, %.2f, %.2f}, /* depth %d, %d samples */\n",
+                   shallow, slope, offset, sigma, depth, (int)fit->n);
+        }
+
+        printf("    },\n");
+    }
+
+    printf("};\n\n#endif\n");
+}
@@ -0,0 +1,241 @@
+/************************************************************************
+ *
+ *  Board representation: the start position, flipping, playing and taking
+ *  back moves, and converting squares to and from move strings.
+ *
+ ************************************************************************/
+#include "othello.h"
+
+#if BOARD_SIZE == 8
+#include "flip_tables.h"
+
+/* gathers a file into a byte indexed by row, and spreads it back again */
+#define FILE_MAGIC 0x0102040810204080ULL
+#endif
+
+/**
+ * Returns the start position, viewed from black, who moves first.
+ *
+ * @return the start position
+ */
+Position start_position(void) {
+    int mid = BOARD_SIZE / 2;
+    Position pos;
+
+    pos.player = SQUARE_BIT(mid * BOARD_SIZE + (mid - 1)) |
+                 SQUARE_BIT((mid - 1) * BOARD_SIZE + mid);
+    pos.opponent = SQUARE_BIT(mid * BOARD_SIZE + mid) |
+                   SQUARE_BIT((mid - 1) * BOARD_SIZE + (mid - 1));
+
+    return pos;
+}
+
+/**
+ * Shifts every disc in the given bitboard one square in the given direction,
+ * dropping discs that would wrap around to the opposite side of the board.
+ * Directions are numbered clockwise from east: E, SE, S, SW, W, NW, N, NE.
+ *
+ * @param discs bitboard to shift
+ * @param dir direction to shift in (0-7)
+ * @return the shifted bitboard
+ */
+Bitboard shift_discs(Bitboard discs, int dir) {
+    switch (dir) {
+    case 0: return (discs << 1) & NOT_A_FILE;
+    case 1: return (discs << (BOARD_SIZE + 1)) & NOT_A_FILE;
+    case 2: return (discs << BOARD_SIZE) & FULL_BOARD;
+    case 3: return (discs << (BOARD_SIZE - 1)) & NOT_H_FILE;
+    case 4: return (discs >> 1) & NOT_H_FILE;
+    case 5: return (discs >> (BOARD_SIZE + 1)) & NOT_H_FILE;
+    case 6: return discs >> BOARD_SIZE;
+    default: return (discs >> (BOARD_SIZE - 1)) & NOT_A_FILE;
+    }
+}
+
+/**
+ * Returns the discs that would be flipped by the player placing a piece on the
+ * given square. A line of the opponent's discs is flipped when it is
+ * sandwiched between the new piece and another of the player's discs.
+ *
+ * Each of the four lines through the square is gathered into a byte, where
+ * OUTFLANK gives the squares that would close a run of the opponent's discs
+ * and FLIPPED the discs between the new piece and the closing squares the
+ * player holds. The tables are generated by gen_flip_tables.c.
+ *
+ * @param player bitboard of the player placing the piece
+ * @param opponent bitboard of the opponent
+ * @param move square the piece is placed on
+ * @return bitboard of the discs to flip
+ */
+#if BOARD_SIZE == 8
+Bitboard get_flips(Bitboard player, Bitboard opponent, int move) {
+    int row = move / BOARD_SIZE;
+    int col = move % BOARD_SIZE;
+    uint64_t flips;
+    uint64_t mask;
+    int outflank;
+
+    /* rank, indexed by column */
+    outflank = OUTFLANK[col][(opponent >> (row * BOARD_SIZE + 1)) & 0x3f] &
+               (int)((player >> (row * BOARD_SIZE)) & 0xff);
+    flips = (uint64_t)FLIPPED[col][outflank] << (row * BOARD_SIZE);
+
+    /* file, indexed by row */
+    outflank = OUTFLANK[row][((((opponent >> col) & A_FILE) * FILE_MAGIC) >> 57) & 0x3f] &
+               (int)((((player >> col) & A_FILE) * FILE_MAGIC) >> 56);
+    flips |= (((uint64_t)FLIPPED[row][outflank] * FILE_MAGIC) & H_FILE) >> (7 - col);
+
+    /* diagonals, indexed by column */
+    mask = DIAGONAL_MASK[move];
+    outflank = OUTFLANK[col][(((opponent & mask) * A_FILE) >> 57) & 0x3f] &
+               (int)(((player & mask) * A_FILE) >> 56);
+    flips |= ((uint64_t)FLIPPED[col][outflank] * A_FILE) & mask;
+
+    mask = ANTI_DIAGONAL_MASK[move];
+    outflank = OUTFLANK[col][(((opponent & mask) * A_FILE) >> 57) & 0x3f] &
+               (int)(((player & mask) * A_FILE) >> 56);
+    flips |= ((uint64_t)FLIPPED[col][outflank] * A_FILE) & mask;
+
+    return flips;
+}
+#else
+/**
+ * Returns the discs that would be flipped by the player placing a piece on the
+ * given square. The flip tables only cover 8x8 boards, so on other sizes each
+ * direction is walked from the square until the run of the opponent's discs
+ * ends.
+ *
+ * @param player bitboard of the player placing the piece
+ * @param opponent bitboard of the opponent
+ * @param move square the piece is placed on
+ * @return bitboard of the discs to flip
+ */
+Bitboard get_flips(Bitboard player, Bitboard opponent, int move) {
+    Bitboard flips = 0;
+
+    for (int dir = 0; dir < 8; dir++) {
+        Bitboard run = 0;
+        Bitboard square = shift_discs(SQUARE_BIT(move), dir);
+
+        while (square & opponent) {
+            run |= square;
+            square = shift_discs(square, dir);
+        }
+
+        if (square & player) {
+            flips |= run;
+        }
+    }
+
+    return flips;
+}
+#endif
+
+/**
+ * Plays a move for the side to move in the given position and hands the turn
+ * to the opponent. A negative move is a pass.
+ *
+ * @param pos position to play the move in
+ * @param move square to place the piece on, or -1 to pass
+ * @return bitboard of the flipped discs, needed to undo the move
+ */
+Bitboard play_move(Position *pos, int move) {
+    Bitboard player = pos->player;
+    Bitboard flips = 0;
+
+    pos->player = pos->opponent;
+    pos->opponent = player;
+
+    if (move >= 0) {
+        flips = get_flips(player, pos->player, move);
+
+        pos->player ^= flips;
+        pos->opponent |= flips | SQUARE_BIT(move);
+    }
+
+    return flips;
+}
+
+/**
+ * Takes back a move played with play_move.
+ *
+ * @param pos position the move was played in
+ * @param move square the piece was placed on, or -1 for a pass
+ * @param flips discs flipped by the move
+ */
+void undo_move(Position *pos, int move, Bitboard flips) {
+    Bitboard player = pos->opponent;
+
+    pos->opponent = pos->player;
+    pos->player = player;
+
+    if (move >= 0) {
+        pos->player ^= flips | SQUARE_BIT(move);
+        pos->opponent ^= flips;
+    }
+}
+
+/**
+ * Lists the squares of a move bitboard in ascending order, followed by a -1.
+ *
+ * @param moves bitboard of the moves
+ * @param list array of at least MAX_MOVES + 1 entries to store the moves in
+ * @return number of moves
+ */
+int list_moves(Bitboard moves, int *list) {
+    int count = 0;
+
+    while (moves) {
+        list[count++] = first_square(moves);
+        moves &= moves - 1;
+    }
+
+    list[count] = -1; // End of moves
+    return count;
+}
+
+/**
+ * Converts a move string of the form "rc" to a square, where r and c are the
+ * row and column counted from 1, with '0' standing for 10 on 10x10 boards.
+ * "pass" and "-1" are passes.
+ *
+ * @param movestring move string to convert
+ * @return the square, or -1 for a pass or a string off the board
+ */
+int get_loc(const char *movestring) {
+    if (movestring[0] == 'p' || (movestring[0] == '-' && movestring[1] == '1')) {
+        return -1;
+    }
+
+    int row = movestring[0] == '0' ? 9 : movestring[0] - '1';
+    int col = movestring[1] == '0' ? 9 : movestring[1] - '1';
+
+    if (row < 0 || row >= BOARD_SIZE || col < 0 || col >= BOARD_SIZE) {
+        return -1;
+    }
+
+    return row * BOARD_SIZE + col;
+}
+
+/**
+ * Converts a square to a move string of the form "rc", where r and c are the
+ * row and column counted from 1, with '0' standing for 10 on 10x10 boards. A
+ * negative square is written as "pass".
+ *
+ * @param loc square to convert, or -1 for a pass
+ * @param ms buffer of at least 5 characters to store the move string in
+ */
+void get_move_string(int loc, char *ms) {
+    if (loc < 0) {
+        ms[0] = 'p';
+        ms[1] = 'a';
+        ms[2] = 's';
+        ms[3] = 's';
+        ms[4] = 0;
+        return;
+    }
+
+    ms[0] = "1234567890"[loc / BOARD_SIZE];
+    ms[1] = "1234567890"[loc % BOARD_SIZE];
+    ms[2] = 0;
+}
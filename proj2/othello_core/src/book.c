@@ -0,0 +1,167 @@
+/************************************************************************
+ *
+ *  Opening book: a file of positions with the move to play in each.
+ *
+ *  The file is a header followed by the entries sorted by position key,
+ *  exactly as they are laid out in memory, so a book is mapped read-only
+ *  and probed in place by binary search, with nothing to parse or allocate.
+ *  Pages are only read from disk when a probe first touches them. The file
+ *  is in the byte order of the machine that wrote it.
+ *
+ ************************************************************************/
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "othello.h"
+
+#define BOOK_MAGIC "OTHBOOK1"
+
+/* the file header; the entries follow it, 8-byte aligned */
+typedef struct {
+    char magic[8];
+    uint32_t board_size;
+    uint32_t entry_size;
+    uint64_t count;
+} BookHeader;
+
+int compare_book_entries(const void *, const void *);
+
+/**
+ * Maps an opening book file. The book must have been written for this board
+ * size by write_book.
+ *
+ * @param book receives the mapping, or an empty book on failure
+ * @param path book file to map
+ * @return 1 if the book was mapped, 0 if it is missing or not a valid book
+ */
+int open_book(OpeningBook *book, const char *path) {
+    struct stat info;
+    const BookHeader *header;
+    int fd;
+
+    memset(book, 0, sizeof(*book));
+
+    if ((fd = open(path, O_RDONLY)) < 0) {
+        return 0;
+    }
+
+    if (fstat(fd, &info) != 0 || (size_t)info.st_size < sizeof(BookHeader)) {
+        close(fd);
+        return 0;
+    }
+
+    void *map = mmap(NULL, (size_t)info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+    /* the mapping stays valid once the file is closed */
+    close(fd);
+
+    if (map == MAP_FAILED) {
+        return 0;
+    }
+
+    header = map;
+
+    if (memcmp(header->magic, BOOK_MAGIC, sizeof(header->magic)) != 0 ||
+        header->board_size != BOARD_SIZE || header->entry_size != sizeof(BookEntry) ||
+        (size_t)info.st_size != sizeof(BookHeader) + header->count * sizeof(BookEntry)) {
+        munmap(map, (size_t)info.st_size);
+        return 0;
+    }
+
+    book->entries = (const BookEntry *)(header + 1);
+    book->count = (size_t)header->count;
+    book->map = map;
+    book->bytes = (size_t)info.st_size;
+    return 1;
+}
+
+/**
+ * Unmaps an opening book. An empty book is left as it is.
+ *
+ * @param book book to unmap
+ */
+void close_book(OpeningBook *book) {
+    if (book->map != NULL) {
+        munmap(book->map, book->bytes);
+    }
+
+    memset(book, 0, sizeof(*book));
+}
+
+/**
+ * Looks a position up in an opening book.
+ *
+ * @param book book to search, possibly empty
+ * @param key hash key of the position, from hash_position
+ * @return the position's entry, or NULL if it is not in the book
+ */
+const BookEntry *probe_book(const OpeningBook *book, uint64_t key) {
+    size_t low = 0;
+    size_t high = book->count;
+
+    while (low < high) {
+        size_t middle = low + (high - low) / 2;
+
+        if (book->entries[middle].key < key) {
+            low = middle + 1;
+        } else {
+            high = middle;
+        }
+    }
+
+    if (low < book->count && book->entries[low].key == key) {
+        return &book->entries[low];
+    }
+
+    return NULL;
+}
+
+/**
+ * Writes an opening book file. The entries are sorted by key in place, and
+ * every key must appear once.
+ *
+ * @param path book file to write
+ * @param entries entries of the book
+ * @param count number of entries
+ * @return 1 if the book was written, 0 on an error
+ */
+int write_book(const char *path, BookEntry *entries, size_t count) {
+    BookHeader header;
+    FILE *file;
+    int written;
+
+    qsort(entries, count, sizeof(BookEntry), compare_book_entries);
+
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, BOOK_MAGIC, sizeof(header.magic));
+    header.board_size = BOARD_SIZE;
+    header.entry_size = sizeof(BookEntry);
+    header.count = count;
+
+    if ((file = fopen(path, "wb")) == NULL) {
+        return 0;
+    }
+
+    written = fwrite(&header, sizeof(header), 1, file) == 1 &&
+              fwrite(entries, sizeof(BookEntry), count, file) == count;
+
+    return (fclose(file) == 0) && written;
+}
+
+/**
+ * Orders book entries by key, for qsort.
+ *
+ * @param a first entry
+ * @param b second entry
+ * @return negative, zero or positive as a's key is below, equal to or above b's
+ */
+int compare_book_entries(const void *a, const void *b) {
+    uint64_t key_a = ((const BookEntry *)a)->key;
+    uint64_t key_b = ((const BookEntry *)b)->key;
+
+    return (key_a > key_b) - (key_a < key_b);
+}
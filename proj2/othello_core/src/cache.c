@@ -0,0 +1,71 @@
+/************************************************************************
+ *
+ *  Memory for large position caches such as the transposition table.
+ *
+ *  Caches are probed at random addresses at every node, so each probe is
+ *  likely to miss both the data cache and the TLB. The memory is mapped with
+ *  huge pages when the system has them to spare, which covers the table with
+ *  a few TLB entries instead of one per 4KB page, and falls back to asking
+ *  for transparent huge pages, then to normal pages.
+ *
+ ************************************************************************/
+#define _GNU_SOURCE
+#include <sys/mman.h>
+#include "othello.h"
+
+#define HUGE_PAGE_SIZE ((size_t)2 << 20)
+
+/* how the last cache was backed, for the logs */
+const char *cache_memory_name = "none";
+
+/**
+ * Maps zeroed, page-aligned memory for a cache. Sizes that are a multiple of
+ * the huge page size can be backed by huge pages.
+ *
+ * @param bytes size of the cache in bytes
+ * @return the memory, or NULL if it could not be mapped
+ */
+void *allocate_cache(size_t bytes) {
+    void *memory;
+
+#ifdef MAP_HUGETLB
+    if (bytes % HUGE_PAGE_SIZE == 0) {
+        memory = mmap(NULL, bytes, PROT_READ | PROT_WRITE,
+                      MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+
+        if (memory != MAP_FAILED) {
+            cache_memory_name = "huge pages";
+            return memory;
+        }
+    }
+#endif
+
+    memory = mmap(NULL, bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+    if (memory == MAP_FAILED) {
+        cache_memory_name = "none";
+        return NULL;
+    }
+
+    cache_memory_name = "normal pages";
+
+#ifdef MADV_HUGEPAGE
+    if (bytes % HUGE_PAGE_SIZE == 0 && madvise(memory, bytes, MADV_HUGEPAGE) == 0) {
+        cache_memory_name = "transparent huge pages";
+    }
+#endif
+
+    return memory;
+}
+
+/**
+ * Unmaps memory returned by allocate_cache.
+ *
+ * @param memory memory to unmap, or NULL
+ * @param bytes size the memory was allocated with
+ */
+void free_cache(void *memory, size_t bytes) {
+    if (memory != NULL) {
+        munmap(memory, bytes);
+    }
+}
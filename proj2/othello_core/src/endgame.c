@@ -0,0 +1,613 @@
+/************************************************************************
+ *
+ *  Exact endgame solver: searches to the end of the game and returns the
+ *  final disc difference, counted as the referee counts it, so empty squares
+ *  left when neither side can move belong to nobody.
+ *
+ *  Nodes with many empties are worth some work each: they use the
+ *  transposition table, are ordered fastest-first (the moves leaving the
+ *  opponent the fewest replies first) and are cut off when the opponent's
+ *  stable discs alone keep the score below the window. Nearer the end a node
+ *  costs little more than a flip, so moves are only ordered by parity, the
+ *  squares in regions with an odd number of empties first, and the last four
+ *  empties have their own unrolled routines.
+ *
+ *  Regions are the four quadrants of the board.
+ *
+ ************************************************************************/
+#include "othello.h"
+
+/* empties at and below which nodes are only ordered by parity */
+#define SHALLOW_EMPTIES 6
+
+_Static_assert(SHALLOW_EMPTIES >= 5, "the shallow search hands over to the four-empty routine");
+
+/* nodes searched between two polls of the caller's time check */
+#define POLL_INTERVAL 4096
+
+/* a score beyond any disc difference */
+#define SOLVE_INFINITY (BOARD_SQUARES + 1)
+
+/* xored into the keys of endgame entries, so they never match the midgame
+   entries of the same positions, whose scores are on another scale */
+#define ENDGAME_KEY 0xd6e8feb86659fd93ULL
+
+#define LEFT_HALF ((SQUARE_BIT(BOARD_SIZE / 2) - 1) * A_FILE)
+#define TOP_HALF (SQUARE_BIT(BOARD_SQUARES / 2) - 1)
+
+int final_score(Bitboard, Bitboard);
+int quadrant(int);
+Bitboard odd_regions(Bitboard);
+int solve_1(Bitboard, Bitboard, int);
+int solve_2(Bitboard, Bitboard, int, int, int, int, int);
+int solve_3(Bitboard, Bitboard, int, int, int, int, int, int);
+int solve_4(Bitboard, Bitboard, int, int, int);
+int solve_shallow(Bitboard, Bitboard, int, int, int, int);
+int solve_deep(Bitboard, Bitboard, HashKey, int, int, int, int);
+
+/* the solve in progress, and the node count at which it next polls */
+EndgameSearch *endgame_search = NULL;
+long long endgame_poll_at = 0;
+
+/* children of the deep nodes, by number of empties */
+ChildBatch endgame_children[BOARD_SQUARES + 1];
+
+/**
+ * Solves a position exactly. The score is exact when it lies inside the
+ * window and otherwise a bound on the same side of the window, as in a
+ * fail-soft alpha-beta search, so a null window around zero finds whether
+ * the game is won, lost or drawn much faster than the exact score.
+ *
+ * The search polls the time check in the given state every few thousand
+ * nodes and gives up once it answers yes, after which the score means
+ * nothing and the state is marked as stopped.
+ *
+ * @param pos position to solve, viewed from the side to move
+ * @param alpha lower bound of the window
+ * @param beta upper bound of the window
+ * @param search node count to add to, time check and stop flag
+ * @return the final disc difference for the side to move
+ */
+int solve_endgame(const Position *pos, int alpha, int beta, EndgameSearch *search) {
+    Bitboard empty = FULL_BOARD & ~(pos->player | pos->opponent);
+    int empties = count_discs(empty);
+    int squares[4];
+    int n = 0;
+
+    endgame_search = search;
+    endgame_poll_at = search->nodes + POLL_INTERVAL;
+    search->stopped = 0;
+
+    if (empties > SHALLOW_EMPTIES) {
+        return solve_deep(pos->player, pos->opponent, hash_position(pos), alpha, beta, empties, 0);
+    } else if (empties > 4) {
+        return solve_shallow(pos->player, pos->opponent, alpha, beta, empties, 0);
+    } else if (empties == 4) {
+        return solve_4(pos->player, pos->opponent, alpha, beta, 0);
+    }
+
+    for (; empty; empty &= empty - 1) {
+        squares[n++] = first_square(empty);
+    }
+
+    if (empties == 3) {
+        return solve_3(pos->player, pos->opponent, alpha, beta, squares[0], squares[1], squares[2], 0);
+    } else if (empties == 2) {
+        return solve_2(pos->player, pos->opponent, alpha, beta, squares[0], squares[1], 0);
+    } else if (empties == 1) {
+        return solve_1(pos->player, pos->opponent, squares[0]);
+    }
+
+    search->nodes++;
+    return final_score(pos->player, pos->opponent);
+}
+
+/**
+ * Returns the disc difference of a finished game.
+ *
+ * @param player bitboard of the side to move
+ * @param opponent bitboard of the other side
+ * @return the player's discs minus the opponent's
+ */
+int final_score(Bitboard player, Bitboard opponent) {
+    return count_discs(player) - count_discs(opponent);
+}
+
+/**
+ * Returns the parity region of a square.
+ *
+ * @param square square to look up
+ * @return the quadrant of the square, from 0 to 3
+ */
+int quadrant(int square) {
+    return (square >= BOARD_SQUARES / 2) * 2 + (square % BOARD_SIZE >= BOARD_SIZE / 2);
+}
+
+/**
+ * Returns the empty squares of the regions holding an odd number of them.
+ * The side that moves last in a region tends to keep what it takes there,
+ * so moving into an odd region first usually leaves the last move in it.
+ *
+ * @param empty bitboard of the empty squares
+ * @return the empty squares in odd regions
+ */
+Bitboard odd_regions(Bitboard empty) {
+    Bitboard regions[4] = {
+        TOP_HALF & LEFT_HALF,
+        TOP_HALF & ~LEFT_HALF,
+        FULL_BOARD & ~TOP_HALF & LEFT_HALF,
+        FULL_BOARD & ~TOP_HALF & ~LEFT_HALF,
+    };
+    Bitboard odd = 0;
+
+    for (int i = 0; i < 4; i++) {
+        if (count_discs(empty & regions[i]) & 1) {
+            odd |= empty & regions[i];
+        }
+    }
+
+    return odd;
+}
+
+/**
+ * Solves a position with one empty square. The side to move takes it if it
+ * can, otherwise the opponent does, otherwise the game ends with it empty.
+ *
+ * @param player bitboard of the side to move
+ * @param opponent bitboard of the other side
+ * @param square the empty square
+ * @return the final disc difference for the side to move
+ */
+int solve_1(Bitboard player, Bitboard opponent, int square) {
+    int score = final_score(player, opponent);
+    Bitboard flips;
+
+    endgame_search->nodes++;
+
+    if ((flips = get_flips(player, opponent, square)) != 0) {
+        return score + 2 * count_discs(flips) + 1;
+    }
+
+    if ((flips = get_flips(opponent, player, square)) != 0) {
+        return score - 2 * count_discs(flips) - 1;
+    }
+
+    return score;
+}
+
+/**
+ * Solves a position with two empty squares.
+ *
+ * @param player bitboard of the side to move
+ * @param opponent bitboard of the other side
+ * @param alpha lower bound of the window
+ * @param beta upper bound of the window
+ * @param s1 first empty square
+ * @param s2 second empty square
+ * @param passed whether the opponent has just passed
+ * @return the final disc difference for the side to move
+ */
+int solve_2(Bitboard player, Bitboard opponent, int alpha, int beta, int s1, int s2, int passed) {
+    int best = -SOLVE_INFINITY;
+    int score;
+    Bitboard flips;
+
+    endgame_search->nodes++;
+
+    if ((flips = get_flips(player, opponent, s1)) != 0) {
+        best = -solve_1(opponent ^ flips, player | flips | SQUARE_BIT(s1), s2);
+
+        if (best >= beta) {
+            return best;
+        }
+    }
+
+    if ((flips = get_flips(player, opponent, s2)) != 0) {
+        score = -solve_1(opponent ^ flips, player | flips | SQUARE_BIT(s2), s1);
+
+        if (score > best) {
+            best = score;
+        }
+    }
+
+    if (best == -SOLVE_INFINITY) {
+        if (passed) {
+            return final_score(player, opponent);
+        }
+
+        return -solve_2(opponent, player, -beta, -alpha, s1, s2, 1);
+    }
+
+    return best;
+}
+
+/**
+ * Solves a position with three empty squares. Two of them may share a
+ * region, and then the third, alone in its region, is tried first.
+ *
+ * @param player bitboard of the side to move
+ * @param opponent bitboard of the other side
+ * @param alpha lower bound of the window
+ * @param beta upper bound of the window
+ * @param s1 first empty square
+ * @param s2 second empty square
+ * @param s3 third empty square
+ * @param passed whether the opponent has just passed
+ * @return the final disc difference for the side to move
+ */
+int solve_3(Bitboard player, Bitboard opponent, int alpha, int beta, int s1, int s2, int s3, int passed) {
+    int best = -SOLVE_INFINITY;
+    int score;
+    Bitboard flips;
+
+    endgame_search->nodes++;
+
+    if (quadrant(s1) == quadrant(s2) && quadrant(s1) != quadrant(s3)) {
+        int lone = s3;
+
+        s3 = s2;
+        s2 = s1;
+        s1 = lone;
+    } else if (quadrant(s1) == quadrant(s3) && quadrant(s1) != quadrant(s2)) {
+        int lone = s2;
+
+        s2 = s1;
+        s1 = lone;
+    }
+
+    if ((flips = get_flips(player, opponent, s1)) != 0) {
+        best = -solve_2(opponent ^ flips, player | flips | SQUARE_BIT(s1), -beta, -alpha, s2, s3, 0);
+
+        if (best >= beta) {
+            return best;
+        }
+        if (best > alpha) {
+            alpha = best;
+        }
+    }
+
+    if ((flips = get_flips(player, opponent, s2)) != 0) {
+        score = -solve_2(opponent ^ flips, player | flips | SQUARE_BIT(s2), -beta, -alpha, s1, s3, 0);
+
+        if (score > best) {
+            best = score;
+
+            if (best >= beta) {
+                return best;
+            }
+            if (best > alpha) {
+                alpha = best;
+            }
+        }
+    }
+
+    if ((flips = get_flips(player, opponent, s3)) != 0) {
+        score = -solve_2(opponent ^ flips, player | flips | SQUARE_BIT(s3), -beta, -alpha, s1, s2, 0);
+
+        if (score > best) {
+            best = score;
+        }
+    }
+
+    if (best == -SOLVE_INFINITY) {
+        if (passed) {
+            return final_score(player, opponent);
+        }
+
+        return -solve_3(opponent, player, -beta, -alpha, s1, s2, s3, 1);
+    }
+
+    return best;
+}
+
+/**
+ * Solves a position with four empty squares, trying the squares of odd
+ * regions first.
+ *
+ * @param player bitboard of the side to move
+ * @param opponent bitboard of the other side
+ * @param alpha lower bound of the window
+ * @param beta upper bound of the window
+ * @param passed whether the opponent has just passed
+ * @return the final disc difference for the side to move
+ */
+int solve_4(Bitboard player, Bitboard opponent, int alpha, int beta, int passed) {
+    Bitboard empty = FULL_BOARD & ~(player | opponent);
+    Bitboard odd = odd_regions(empty);
+    int best = -SOLVE_INFINITY;
+    int score;
+    int s[4];
+    int n = 0;
+    Bitboard flips;
+
+    endgame_search->nodes++;
+
+    for (Bitboard squares = odd; squares; squares &= squares - 1) {
+        s[n++] = first_square(squares);
+    }
+    for (Bitboard squares = empty & ~odd; squares; squares &= squares - 1) {
+        s[n++] = first_square(squares);
+    }
+
+    if ((flips = get_flips(player, opponent, s[0])) != 0) {
+        best = -solve_3(opponent ^ flips, player | flips | SQUARE_BIT(s[0]), -beta, -alpha, s[1], s[2], s[3], 0);
+
+        if (best >= beta) {
+            return best;
+        }
+        if (best > alpha) {
+            alpha = best;
+        }
+    }
+
+    if ((flips = get_flips(player, opponent, s[1])) != 0) {
+        score = -solve_3(opponent ^ flips, player | flips | SQUARE_BIT(s[1]), -beta, -alpha, s[0], s[2], s[3], 0);
+
+        if (score > best) {
+            best = score;
+
+            if (best >= beta) {
+                return best;
+            }
+            if (best > alpha) {
+                alpha = best;
+            }
+        }
+    }
+
+    if ((flips = get_flips(player, opponent, s[2])) != 0) {
+        score = -solve_3(opponent ^ flips, player | flips | SQUARE_BIT(s[2]), -beta, -alpha, s[0], s[1], s[3], 0);
+
+        if (score > best) {
+            best = score;
+
+            if (best >= beta) {
+                return best;
+            }
+            if (best > alpha) {
+                alpha = best;
+            }
+        }
+    }
+
+    if ((flips = get_flips(player, opponent, s[3])) != 0) {
+        score = -solve_3(opponent ^ flips, player | flips | SQUARE_BIT(s[3]), -beta, -alpha, s[0], s[1], s[2], 0);
+
+        if (score > best) {
+            best = score;
+        }
+    }
+
+    if (best == -SOLVE_INFINITY) {
+        if (passed) {
+            return final_score(player, opponent);
+        }
+
+        return -solve_4(opponent, player, -beta, -alpha, 1);
+    }
+
+    return best;
+}
+
+/**
+ * Solves a position with a few more empties than the unrolled routines
+ * take, trying the moves into odd regions first.
+ *
+ * @param player bitboard of the side to move
+ * @param opponent bitboard of the other side
+ * @param alpha lower bound of the window
+ * @param beta upper bound of the window
+ * @param empties number of empty squares
+ * @param passed whether the opponent has just passed
+ * @return the final disc difference for the side to move
+ */
+int solve_shallow(Bitboard player, Bitboard opponent, int alpha, int beta, int empties, int passed) {
+    Bitboard moves = get_moves(player, opponent);
+    Bitboard odd = odd_regions(FULL_BOARD & ~(player | opponent));
+    int best = -SOLVE_INFINITY;
+
+    endgame_search->nodes++;
+
+    if (moves == 0) {
+        if (passed) {
+            return final_score(player, opponent);
+        }
+
+        return -solve_shallow(opponent, player, -beta, -alpha, empties, 1);
+    }
+
+    for (int even = 0; even < 2; even++) {
+        for (Bitboard candidates = moves & (even ? ~odd : odd); candidates; candidates &= candidates - 1) {
+            int square = first_square(candidates);
+            Bitboard flips = get_flips(player, opponent, square);
+            Bitboard next_player = opponent ^ flips;
+            Bitboard next_opponent = player | flips | SQUARE_BIT(square);
+            int score;
+
+            if (empties == 5) {
+                score = -solve_4(next_player, next_opponent, -beta, -alpha, 0);
+            } else {
+                score = -solve_shallow(next_player, next_opponent, -beta, -alpha, empties - 1, 0);
+            }
+
+            if (score > best) {
+                best = score;
+
+                if (best >= beta) {
+                    return best;
+                }
+                if (best > alpha) {
+                    alpha = best;
+                }
+            }
+        }
+    }
+
+    return best;
+}
+
+/**
+ * Solves a position with many empties. The best move of an earlier solve of
+ * the position is tried first and the others fastest-first, counting the
+ * opponent's corner replies twice and preferring odd regions on ties. Only
+ * the first move is searched with the full window, the others with a null
+ * window first, as in PVS.
+ *
+ * @param player bitboard of the side to move
+ * @param opponent bitboard of the other side
+ * @param hash keys of the position
+ * @param alpha lower bound of the window
+ * @param beta upper bound of the window
+ * @param empties number of empty squares
+ * @param passed whether the opponent has just passed
+ * @return the final disc difference for the side to move
+ */
+int solve_deep(Bitboard player, Bitboard opponent, HashKey hash, int alpha, int beta, int empties, int passed) {
+    EndgameSearch *search = endgame_search;
+    ChildBatch *batch = &endgame_children[empties];
+    Position pos = {player, opponent};
+    uint64_t key = hash.key ^ ENDGAME_KEY;
+    int alpha_orig = alpha;
+    int best = -SOLVE_INFINITY;
+    int best_move = -1;
+    int stored_move = -1;
+    int order[MAX_MOVES];
+    int keys[MAX_MOVES];
+
+    if (++search->nodes >= endgame_poll_at) {
+        endgame_poll_at = search->nodes + POLL_INTERVAL;
+
+        if (search->time_up != NULL && search->time_up()) {
+            search->stopped = 1;
+        }
+    }
+
+    if (search->stopped) {
+        return 0;
+    }
+
+    /* the opponent keeps its stable discs, which caps the player's score;
+       stable discs are never more than all of the opponent's discs, so the
+       check is skipped when even those would not cap it */
+    if (BOARD_SQUARES - 2 * count_discs(opponent) <= alpha) {
+        int upper = BOARD_SQUARES - 2 * count_discs(get_stable_discs(opponent, player));
+
+        if (upper <= alpha) {
+            return upper;
+        }
+    }
+
+    TTEntry *entry = probe_transposition(key);
+
+    if (entry != NULL) {
+        if ((entry->bound & BOUND_LOWER) && entry->lower >= beta) {
+            return entry->lower;
+        }
+        if ((entry->bound & BOUND_UPPER) && entry->upper <= alpha) {
+            return entry->upper;
+        }
+        if (entry->bound == BOUND_EXACT && entry->lower == entry->upper) {
+            return entry->lower;
+        }
+
+        stored_move = entry->move;
+    }
+
+    Bitboard moves = get_moves(player, opponent);
+
+    if (moves == 0) {
+        if (passed) {
+            return final_score(player, opponent);
+        }
+
+        hash_move(&hash, -1, 0);
+        return -solve_deep(opponent, player, hash, -beta, -alpha, empties, 1);
+    }
+
+    generate_children(&pos, moves, batch);
+
+    Bitboard odd = odd_regions(FULL_BOARD & ~(player | opponent));
+
+    /* insertion sort, move lists are short */
+    for (int i = 0; i < batch->count; i++) {
+        int square = batch->square[i];
+        int sort_key = 2 * (count_discs(batch->mobility[i]) + count_discs(batch->mobility[i] & CORNER_SQUARES)) +
+                       ((odd & SQUARE_BIT(square)) == 0);
+        int j = i;
+
+        if (square == stored_move) {
+            sort_key = -1;
+        }
+
+        while (j > 0 && keys[j - 1] > sort_key) {
+            order[j] = order[j - 1];
+            keys[j] = keys[j - 1];
+            j--;
+        }
+
+        order[j] = i;
+        keys[j] = sort_key;
+    }
+
+    for (int i = 0; i < batch->count; i++) {
+        int child = order[i];
+        int square = batch->square[child];
+        Bitboard next_player = batch->player[child];
+        Bitboard next_opponent = batch->opponent[child];
+        HashKey next_hash = hash;
+        int score;
+
+        if (empties - 1 > SHALLOW_EMPTIES) {
+            hash_move(&next_hash, square, opponent ^ next_player);
+            prefetch_transposition(next_hash.key ^ ENDGAME_KEY);
+
+            if (i > 0) {
+                score = -solve_deep(next_player, next_opponent, next_hash, -alpha - 1, -alpha, empties - 1, 0);
+
+                if (score > alpha && score < beta) {
+                    score = -solve_deep(next_player, next_opponent, next_hash, -beta, -alpha, empties - 1, 0);
+                }
+            } else {
+                score = -solve_deep(next_player, next_opponent, next_hash, -beta, -alpha, empties - 1, 0);
+            }
+        } else {
+            if (i > 0) {
+                score = -solve_shallow(next_player, next_opponent, -alpha - 1, -alpha, empties - 1, 0);
+
+                if (score > alpha && score < beta) {
+                    score = -solve_shallow(next_player, next_opponent, -beta, -alpha, empties - 1, 0);
+                }
+            } else {
+                score = -solve_shallow(next_player, next_opponent, -beta, -alpha, empties - 1, 0);
+            }
+        }
+
+        if (search->stopped) {
+            return 0;
+        }
+
+        if (score > best) {
+            best = score;
+            best_move = square;
+
+            if (best >= beta) {
+                break;
+            }
+            if (best > alpha) {
+                alpha = best;
+            }
+        }
+    }
+
+    int bound = BOUND_EXACT;
+
+    if (best <= alpha_orig) {
+        bound = BOUND_UPPER;
+    } else if (best >= beta) {
+        bound = BOUND_LOWER;
+    }
+
+    store_transposition(key, empties, bound, best, best_move);
+
+    return best;
+}
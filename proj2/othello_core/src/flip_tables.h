@@ -0,0 +1,243 @@
+/* Generated by gen_flip_tables.c, do not edit. */
+#ifndef FLIP_TABLES_H
+#define FLIP_TABLES_H
+
+#include <stdint.h>
+
+static const uint8_t OUTFLANK[8][64] = {
+    {
+        0x00, 0x04, 0x00, 0x08, 0x00, 0x04, 0x00, 0x10, 0x00, 0x04, 0x00, 0x08, 0x00, 0x04, 0x00, 0x20,
+        0x00, 0x04, 0x00, 0x08, 0x00, 0x04, 0x00, 0x10, 0x00, 0x04, 0x00, 0x08, 0x00, 0x04, 0x00, 0x40,
+        0x00, 0x04, 0x00, 0x08, 0x00, 0x04, 0x00, 0x10, 0x00, 0x04, 0x00, 0x08, 0x00, 0x04, 0x00, 0x20,
+        0x00, 0x04, 0x00, 0x08, 0x00, 0x04, 0x00, 0x10, 0x00, 0x04, 0x00, 0x08, 0x00, 0x04, 0x00, 0x80
+    },
+    {
+        0x00, 0x00, 0x08, 0x08, 0x00, 0x00, 0x10, 0x10, 0x00, 0x00, 0x08, 0x08, 0x00, 0x00, 0x20, 0x20,
+        0x00, 0x00, 0x08, 0x08, 0x00, 0x00, 0x10, 0x10, 0x00, 0x00, 0x08, 0x08, 0x00, 0x00, 0x40, 0x40,
+        0x00, 0x00, 0x08, 0x08, 0x00, 0x00, 0x10, 0x10, 0x00, 0x00, 0x08, 0x08, 0x00, 0x00, 0x20, 0x20,
+        0x00, 0x00, 0x08, 0x08, 0x00, 0x00, 0x10, 0x10, 0x00, 0x00, 0x08, 0x08, 0x00, 0x00, 0x80, 0x80
+    },
+    {
+        0x00, 0x01, 0x00, 0x01, 0x10, 0x11, 0x10, 0x11, 0x00, 0x01, 0x00, 0x01, 0x20, 0x21, 0x20, 0x21,
+        0x00, 0x01, 0x00, 0x01, 0x10, 0x11, 0x10, 0x11, 0x00, 0x01, 0x00, 0x01, 0x40, 0x41, 0x40, 0x41,
+        0x00, 0x01, 0x00, 0x01, 0x10, 0x11, 0x10, 0x11, 0x00, 0x01, 0x00, 0x01, 0x20, 0x21, 0x20, 0x21,
+        0x00, 0x01, 0x00, 0x01, 0x10, 0x11, 0x10, 0x11, 0x00, 0x01, 0x00, 0x01, 0x80, 0x81, 0x80, 0x81
+    },
+    {
+        0x00, 0x00, 0x02, 0x01, 0x00, 0x00, 0x02, 0x01, 0x20, 0x20, 0x22, 0x21, 0x20, 0x20, 0x22, 0x21,
+        0x00, 0x00, 0x02, 0x01, 0x00, 0x00, 0x02, 0x01, 0x40, 0x40, 0x42, 0x41, 0x40, 0x40, 0x42, 0x41,
+        0x00, 0x00, 0x02, 0x01, 0x00, 0x00, 0x02, 0x01, 0x20, 0x20, 0x22, 0x21, 0x20, 0x20, 0x22, 0x21,
+        0x00, 0x00, 0x02, 0x01, 0x00, 0x00, 0x02, 0x01, 0x80, 0x80, 0x82, 0x81, 0x80, 0x80, 0x82, 0x81
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x02, 0x01,
+        0x40, 0x40, 0x40, 0x40, 0x44, 0x44, 0x42, 0x41, 0x40, 0x40, 0x40, 0x40, 0x44, 0x44, 0x42, 0x41,
+        0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x02, 0x01,
+        0x80, 0x80, 0x80, 0x80, 0x84, 0x84, 0x82, 0x81, 0x80, 0x80, 0x80, 0x80, 0x84, 0x84, 0x82, 0x81
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 0x08, 0x08, 0x04, 0x04, 0x02, 0x01,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 0x08, 0x08, 0x04, 0x04, 0x02, 0x01,
+        0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x88, 0x88, 0x88, 0x88, 0x84, 0x84, 0x82, 0x81,
+        0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x88, 0x88, 0x88, 0x88, 0x84, 0x84, 0x82, 0x81
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x08, 0x08, 0x08, 0x08, 0x04, 0x04, 0x02, 0x01,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x08, 0x08, 0x08, 0x08, 0x04, 0x04, 0x02, 0x01
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+        0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x08, 0x08, 0x08, 0x08, 0x04, 0x04, 0x02, 0x01
+    },
+};
+
+static const uint8_t FLIPPED[8][256] = {
+    {
+        0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+        0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+        0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e,
+        0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e,
+        0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e,
+        0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e,
+        0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e,
+        0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e,
+        0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e,
+        0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e,
+        0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e,
+        0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e,
+        0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e,
+        0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e,
+        0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e,
+        0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+        0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c,
+        0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c,
+        0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c,
+        0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c,
+        0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c,
+        0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c,
+        0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c,
+        0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c,
+        0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c,
+        0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c,
+        0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c,
+        0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c,
+        0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c,
+        0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c,
+        0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c
+    },
+    {
+        0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02,
+        0x08, 0x0a, 0x08, 0x0a, 0x08, 0x0a, 0x08, 0x0a, 0x08, 0x0a, 0x08, 0x0a, 0x08, 0x0a, 0x08, 0x0a,
+        0x18, 0x1a, 0x18, 0x1a, 0x18, 0x1a, 0x18, 0x1a, 0x18, 0x1a, 0x18, 0x1a, 0x18, 0x1a, 0x18, 0x1a,
+        0x18, 0x1a, 0x18, 0x1a, 0x18, 0x1a, 0x18, 0x1a, 0x18, 0x1a, 0x18, 0x1a, 0x18, 0x1a, 0x18, 0x1a,
+        0x38, 0x3a, 0x38, 0x3a, 0x38, 0x3a, 0x38, 0x3a, 0x38, 0x3a, 0x38, 0x3a, 0x38, 0x3a, 0x38, 0x3a,
+        0x38, 0x3a, 0x38, 0x3a, 0x38, 0x3a, 0x38, 0x3a, 0x38, 0x3a, 0x38, 0x3a, 0x38, 0x3a, 0x38, 0x3a,
+        0x38, 0x3a, 0x38, 0x3a, 0x38, 0x3a, 0x38, 0x3a, 0x38, 0x3a, 0x38, 0x3a, 0x38, 0x3a, 0x38, 0x3a,
+        0x38, 0x3a, 0x38, 0x3a, 0x38, 0x3a, 0x38, 0x3a, 0x38, 0x3a, 0x38, 0x3a, 0x38, 0x3a, 0x38, 0x3a,
+        0x78, 0x7a, 0x78, 0x7a, 0x78, 0x7a, 0x78, 0x7a, 0x78, 0x7a, 0x78, 0x7a, 0x78, 0x7a, 0x78, 0x7a,
+        0x78, 0x7a, 0x78, 0x7a, 0x78, 0x7a, 0x78, 0x7a, 0x78, 0x7a, 0x78, 0x7a, 0x78, 0x7a, 0x78, 0x7a,
+        0x78, 0x7a, 0x78, 0x7a, 0x78, 0x7a, 0x78, 0x7a, 0x78, 0x7a, 0x78, 0x7a, 0x78, 0x7a, 0x78, 0x7a,
+        0x78, 0x7a, 0x78, 0x7a, 0x78, 0x7a, 0x78, 0x7a, 0x78, 0x7a, 0x78, 0x7a, 0x78, 0x7a, 0x78, 0x7a,
+        0x78, 0x7a, 0x78, 0x7a, 0x78, 0x7a, 0x78, 0x7a, 0x78, 0x7a, 0x78, 0x7a, 0x78, 0x7a, 0x78, 0x7a,
+        0x78, 0x7a, 0x78, 0x7a, 0x78, 0x7a, 0x78, 0x7a, 0x78, 0x7a, 0x78, 0x7a, 0x78, 0x7a, 0x78, 0x7a,
+        0x78, 0x7a, 0x78, 0x7a, 0x78, 0x7a, 0x78, 0x7a, 0x78, 0x7a, 0x78, 0x7a, 0x78, 0x7a, 0x78, 0x7a,
+        0x78, 0x7a, 0x78, 0x7a, 0x78, 0x7a, 0x78, 0x7a, 0x78, 0x7a, 0x78, 0x7a, 0x78, 0x7a, 0x78, 0x7a
+    },
+    {
+        0x00, 0x06, 0x04, 0x06, 0x00, 0x06, 0x04, 0x06, 0x00, 0x06, 0x04, 0x06, 0x00, 0x06, 0x04, 0x06,
+        0x00, 0x06, 0x04, 0x06, 0x00, 0x06, 0x04, 0x06, 0x00, 0x06, 0x04, 0x06, 0x00, 0x06, 0x04, 0x06,
+        0x10, 0x16, 0x14, 0x16, 0x10, 0x16, 0x14, 0x16, 0x10, 0x16, 0x14, 0x16, 0x10, 0x16, 0x14, 0x16,
+        0x10, 0x16, 0x14, 0x16, 0x10, 0x16, 0x14, 0x16, 0x10, 0x16, 0x14, 0x16, 0x10, 0x16, 0x14, 0x16,
+        0x30, 0x36, 0x34, 0x36, 0x30, 0x36, 0x34, 0x36, 0x30, 0x36, 0x34, 0x36, 0x30, 0x36, 0x34, 0x36,
+        0x30, 0x36, 0x34, 0x36, 0x30, 0x36, 0x34, 0x36, 0x30, 0x36, 0x34, 0x36, 0x30, 0x36, 0x34, 0x36,
+        0x30, 0x36, 0x34, 0x36, 0x30, 0x36, 0x34, 0x36, 0x30, 0x36, 0x34, 0x36, 0x30, 0x36, 0x34, 0x36,
+        0x30, 0x36, 0x34, 0x36, 0x30, 0x36, 0x34, 0x36, 0x30, 0x36, 0x34, 0x36, 0x30, 0x36, 0x34, 0x36,
+        0x70, 0x76, 0x74, 0x76, 0x70, 0x76, 0x74, 0x76, 0x70, 0x76, 0x74, 0x76, 0x70, 0x76, 0x74, 0x76,
+        0x70, 0x76, 0x74, 0x76, 0x70, 0x76, 0x74, 0x76, 0x70, 0x76, 0x74, 0x76, 0x70, 0x76, 0x74, 0x76,
+        0x70, 0x76, 0x74, 0x76, 0x70, 0x76, 0x74, 0x76, 0x70, 0x76, 0x74, 0x76, 0x70, 0x76, 0x74, 0x76,
+        0x70, 0x76, 0x74, 0x76, 0x70, 0x76, 0x74, 0x76, 0x70, 0x76, 0x74, 0x76, 0x70, 0x76, 0x74, 0x76,
+        0x70, 0x76, 0x74, 0x76, 0x70, 0x76, 0x74, 0x76, 0x70, 0x76, 0x74, 0x76, 0x70, 0x76, 0x74, 0x76,
+        0x70, 0x76, 0x74, 0x76, 0x70, 0x76, 0x74, 0x76, 0x70, 0x76, 0x74, 0x76, 0x70, 0x76, 0x74, 0x76,
+        0x70, 0x76, 0x74, 0x76, 0x70, 0x76, 0x74, 0x76, 0x70, 0x76, 0x74, 0x76, 0x70, 0x76, 0x74, 0x76,
+        0x70, 0x76, 0x74, 0x76, 0x70, 0x76, 0x74, 0x76, 0x70, 0x76, 0x74, 0x76, 0x70, 0x76, 0x74, 0x76
+    },
+    {
+        0x00, 0x0e, 0x0c, 0x0e, 0x08, 0x0e, 0x0c, 0x0e, 0x00, 0x0e, 0x0c, 0x0e, 0x08, 0x0e, 0x0c, 0x0e,
+        0x00, 0x0e, 0x0c, 0x0e, 0x08, 0x0e, 0x0c, 0x0e, 0x00, 0x0e, 0x0c, 0x0e, 0x08, 0x0e, 0x0c, 0x0e,
+        0x00, 0x0e, 0x0c, 0x0e, 0x08, 0x0e, 0x0c, 0x0e, 0x00, 0x0e, 0x0c, 0x0e, 0x08, 0x0e, 0x0c, 0x0e,
+        0x00, 0x0e, 0x0c, 0x0e, 0x08, 0x0e, 0x0c, 0x0e, 0x00, 0x0e, 0x0c, 0x0e, 0x08, 0x0e, 0x0c, 0x0e,
+        0x20, 0x2e, 0x2c, 0x2e, 0x28, 0x2e, 0x2c, 0x2e, 0x20, 0x2e, 0x2c, 0x2e, 0x28, 0x2e, 0x2c, 0x2e,
+        0x20, 0x2e, 0x2c, 0x2e, 0x28, 0x2e, 0x2c, 0x2e, 0x20, 0x2e, 0x2c, 0x2e, 0x28, 0x2e, 0x2c, 0x2e,
+        0x20, 0x2e, 0x2c, 0x2e, 0x28, 0x2e, 0x2c, 0x2e, 0x20, 0x2e, 0x2c, 0x2e, 0x28, 0x2e, 0x2c, 0x2e,
+        0x20, 0x2e, 0x2c, 0x2e, 0x28, 0x2e, 0x2c, 0x2e, 0x20, 0x2e, 0x2c, 0x2e, 0x28, 0x2e, 0x2c, 0x2e,
+        0x60, 0x6e, 0x6c, 0x6e, 0x68, 0x6e, 0x6c, 0x6e, 0x60, 0x6e, 0x6c, 0x6e, 0x68, 0x6e, 0x6c, 0x6e,
+        0x60, 0x6e, 0x6c, 0x6e, 0x68, 0x6e, 0x6c, 0x6e, 0x60, 0x6e, 0x6c, 0x6e, 0x68, 0x6e, 0x6c, 0x6e,
+        0x60, 0x6e, 0x6c, 0x6e, 0x68, 0x6e, 0x6c, 0x6e, 0x60, 0x6e, 0x6c, 0x6e, 0x68, 0x6e, 0x6c, 0x6e,
+        0x60, 0x6e, 0x6c, 0x6e, 0x68, 0x6e, 0x6c, 0x6e, 0x60, 0x6e, 0x6c, 0x6e, 0x68, 0x6e, 0x6c, 0x6e,
+        0x60, 0x6e, 0x6c, 0x6e, 0x68, 0x6e, 0x6c, 0x6e, 0x60, 0x6e, 0x6c, 0x6e, 0x68, 0x6e, 0x6c, 0x6e,
+        0x60, 0x6e, 0x6c, 0x6e, 0x68, 0x6e, 0x6c, 0x6e, 0x60, 0x6e, 0x6c, 0x6e, 0x68, 0x6e, 0x6c, 0x6e,
+        0x60, 0x6e, 0x6c, 0x6e, 0x68, 0x6e, 0x6c, 0x6e, 0x60, 0x6e, 0x6c, 0x6e, 0x68, 0x6e, 0x6c, 0x6e,
+        0x60, 0x6e, 0x6c, 0x6e, 0x68, 0x6e, 0x6c, 0x6e, 0x60, 0x6e, 0x6c, 0x6e, 0x68, 0x6e, 0x6c, 0x6e
+    },
+    {
+        0x00, 0x1e, 0x1c, 0x1e, 0x18, 0x1e, 0x1c, 0x1e, 0x10, 0x1e, 0x1c, 0x1e, 0x18, 0x1e, 0x1c, 0x1e,
+        0x00, 0x1e, 0x1c, 0x1e, 0x18, 0x1e, 0x1c, 0x1e, 0x10, 0x1e, 0x1c, 0x1e, 0x18, 0x1e, 0x1c, 0x1e,
+        0x00, 0x1e, 0x1c, 0x1e, 0x18, 0x1e, 0x1c, 0x1e, 0x10, 0x1e, 0x1c, 0x1e, 0x18, 0x1e, 0x1c, 0x1e,
+        0x00, 0x1e, 0x1c, 0x1e, 0x18, 0x1e, 0x1c, 0x1e, 0x10, 0x1e, 0x1c, 0x1e, 0x18, 0x1e, 0x1c, 0x1e,
+        0x00, 0x1e, 0x1c, 0x1e, 0x18, 0x1e, 0x1c, 0x1e, 0x10, 0x1e, 0x1c, 0x1e, 0x18, 0x1e, 0x1c, 0x1e,
+        0x00, 0x1e, 0x1c, 0x1e, 0x18, 0x1e, 0x1c, 0x1e, 0x10, 0x1e, 0x1c, 0x1e, 0x18, 0x1e, 0x1c, 0x1e,
+        0x00, 0x1e, 0x1c, 0x1e, 0x18, 0x1e, 0x1c, 0x1e, 0x10, 0x1e, 0x1c, 0x1e, 0x18, 0x1e, 0x1c, 0x1e,
+        0x00, 0x1e, 0x1c, 0x1e, 0x18, 0x1e, 0x1c, 0x1e, 0x10, 0x1e, 0x1c, 0x1e, 0x18, 0x1e, 0x1c, 0x1e,
+        0x40, 0x5e, 0x5c, 0x5e, 0x58, 0x5e, 0x5c, 0x5e, 0x50, 0x5e, 0x5c, 0x5e, 0x58, 0x5e, 0x5c, 0x5e,
+        0x40, 0x5e, 0x5c, 0x5e, 0x58, 0x5e, 0x5c, 0x5e, 0x50, 0x5e, 0x5c, 0x5e, 0x58, 0x5e, 0x5c, 0x5e,
+        0x40, 0x5e, 0x5c, 0x5e, 0x58, 0x5e, 0x5c, 0x5e, 0x50, 0x5e, 0x5c, 0x5e, 0x58, 0x5e, 0x5c, 0x5e,
+        0x40, 0x5e, 0x5c, 0x5e, 0x58, 0x5e, 0x5c, 0x5e, 0x50, 0x5e, 0x5c, 0x5e, 0x58, 0x5e, 0x5c, 0x5e,
+        0x40, 0x5e, 0x5c, 0x5e, 0x58, 0x5e, 0x5c, 0x5e, 0x50, 0x5e, 0x5c, 0x5e, 0x58, 0x5e, 0x5c, 0x5e,
+        0x40, 0x5e, 0x5c, 0x5e, 0x58, 0x5e, 0x5c, 0x5e, 0x50, 0x5e, 0x5c, 0x5e, 0x58, 0x5e, 0x5c, 0x5e,
+        0x40, 0x5e, 0x5c, 0x5e, 0x58, 0x5e, 0x5c, 0x5e, 0x50, 0x5e, 0x5c, 0x5e, 0x58, 0x5e, 0x5c, 0x5e,
+        0x40, 0x5e, 0x5c, 0x5e, 0x58, 0x5e, 0x5c, 0x5e, 0x50, 0x5e, 0x5c, 0x5e, 0x58, 0x5e, 0x5c, 0x5e
+    },
+    {
+        0x00, 0x3e, 0x3c, 0x3e, 0x38, 0x3e, 0x3c, 0x3e, 0x30, 0x3e, 0x3c, 0x3e, 0x38, 0x3e, 0x3c, 0x3e,
+        0x20, 0x3e, 0x3c, 0x3e, 0x38, 0x3e, 0x3c, 0x3e, 0x30, 0x3e, 0x3c, 0x3e, 0x38, 0x3e, 0x3c, 0x3e,
+        0x00, 0x3e, 0x3c, 0x3e, 0x38, 0x3e, 0x3c, 0x3e, 0x30, 0x3e, 0x3c, 0x3e, 0x38, 0x3e, 0x3c, 0x3e,
+        0x20, 0x3e, 0x3c, 0x3e, 0x38, 0x3e, 0x3c, 0x3e, 0x30, 0x3e, 0x3c, 0x3e, 0x38, 0x3e, 0x3c, 0x3e,
+        0x00, 0x3e, 0x3c, 0x3e, 0x38, 0x3e, 0x3c, 0x3e, 0x30, 0x3e, 0x3c, 0x3e, 0x38, 0x3e, 0x3c, 0x3e,
+        0x20, 0x3e, 0x3c, 0x3e, 0x38, 0x3e, 0x3c, 0x3e, 0x30, 0x3e, 0x3c, 0x3e, 0x38, 0x3e, 0x3c, 0x3e,
+        0x00, 0x3e, 0x3c, 0x3e, 0x38, 0x3e, 0x3c, 0x3e, 0x30, 0x3e, 0x3c, 0x3e, 0x38, 0x3e, 0x3c, 0x3e,
+        0x20, 0x3e, 0x3c, 0x3e, 0x38, 0x3e, 0x3c, 0x3e, 0x30, 0x3e, 0x3c, 0x3e, 0x38, 0x3e, 0x3c, 0x3e,
+        0x00, 0x3e, 0x3c, 0x3e, 0x38, 0x3e, 0x3c, 0x3e, 0x30, 0x3e, 0x3c, 0x3e, 0x38, 0x3e, 0x3c, 0x3e,
+        0x20, 0x3e, 0x3c, 0x3e, 0x38, 0x3e, 0x3c, 0x3e, 0x30, 0x3e, 0x3c, 0x3e, 0x38, 0x3e, 0x3c, 0x3e,
+        0x00, 0x3e, 0x3c, 0x3e, 0x38, 0x3e, 0x3c, 0x3e, 0x30, 0x3e, 0x3c, 0x3e, 0x38, 0x3e, 0x3c, 0x3e,
+        0x20, 0x3e, 0x3c, 0x3e, 0x38, 0x3e, 0x3c, 0x3e, 0x30, 0x3e, 0x3c, 0x3e, 0x38, 0x3e, 0x3c, 0x3e,
+        0x00, 0x3e, 0x3c, 0x3e, 0x38, 0x3e, 0x3c, 0x3e, 0x30, 0x3e, 0x3c, 0x3e, 0x38, 0x3e, 0x3c, 0x3e,
+        0x20, 0x3e, 0x3c, 0x3e, 0x38, 0x3e, 0x3c, 0x3e, 0x30, 0x3e, 0x3c, 0x3e, 0x38, 0x3e, 0x3c, 0x3e,
+        0x00, 0x3e, 0x3c, 0x3e, 0x38, 0x3e, 0x3c, 0x3e, 0x30, 0x3e, 0x3c, 0x3e, 0x38, 0x3e, 0x3c, 0x3e,
+        0x20, 0x3e, 0x3c, 0x3e, 0x38, 0x3e, 0x3c, 0x3e, 0x30, 0x3e, 0x3c, 0x3e, 0x38, 0x3e, 0x3c, 0x3e
+    },
+    {
+        0x00, 0x7e, 0x7c, 0x7e, 0x78, 0x7e, 0x7c, 0x7e, 0x70, 0x7e, 0x7c, 0x7e, 0x78, 0x7e, 0x7c, 0x7e,
+        0x60, 0x7e, 0x7c, 0x7e, 0x78, 0x7e, 0x7c, 0x7e, 0x70, 0x7e, 0x7c, 0x7e, 0x78, 0x7e, 0x7c, 0x7e,
+        0x40, 0x7e, 0x7c, 0x7e, 0x78, 0x7e, 0x7c, 0x7e, 0x70, 0x7e, 0x7c, 0x7e, 0x78, 0x7e, 0x7c, 0x7e,
+        0x60, 0x7e, 0x7c, 0x7e, 0x78, 0x7e, 0x7c, 0x7e, 0x70, 0x7e, 0x7c, 0x7e, 0x78, 0x7e, 0x7c, 0x7e,
+        0x00, 0x7e, 0x7c, 0x7e, 0x78, 0x7e, 0x7c, 0x7e, 0x70, 0x7e, 0x7c, 0x7e, 0x78, 0x7e, 0x7c, 0x7e,
+        0x60, 0x7e, 0x7c, 0x7e, 0x78, 0x7e, 0x7c, 0x7e, 0x70, 0x7e, 0x7c, 0x7e, 0x78, 0x7e, 0x7c, 0x7e,
+        0x40, 0x7e, 0x7c, 0x7e, 0x78, 0x7e, 0x7c, 0x7e, 0x70, 0x7e, 0x7c, 0x7e, 0x78, 0x7e, 0x7c, 0x7e,
+        0x60, 0x7e, 0x7c, 0x7e, 0x78, 0x7e, 0x7c, 0x7e, 0x70, 0x7e, 0x7c, 0x7e, 0x78, 0x7e, 0x7c, 0x7e,
+        0x00, 0x7e, 0x7c, 0x7e, 0x78, 0x7e, 0x7c, 0x7e, 0x70, 0x7e, 0x7c, 0x7e, 0x78, 0x7e, 0x7c, 0x7e,
+        0x60, 0x7e, 0x7c, 0x7e, 0x78, 0x7e, 0x7c, 0x7e, 0x70, 0x7e, 0x7c, 0x7e, 0x78, 0x7e, 0x7c, 0x7e,
+        0x40, 0x7e, 0x7c, 0x7e, 0x78, 0x7e, 0x7c, 0x7e, 0x70, 0x7e, 0x7c, 0x7e, 0x78, 0x7e, 0x7c, 0x7e,
+        0x60, 0x7e, 0x7c, 0x7e, 0x78, 0x7e, 0x7c, 0x7e, 0x70, 0x7e, 0x7c, 0x7e, 0x78, 0x7e, 0x7c, 0x7e,
+        0x00, 0x7e, 0x7c, 0x7e, 0x78, 0x7e, 0x7c, 0x7e, 0x70, 0x7e, 0x7c, 0x7e, 0x78, 0x7e, 0x7c, 0x7e,
+        0x60, 0x7e, 0x7c, 0x7e, 0x78, 0x7e, 0x7c, 0x7e, 0x70, 0x7e, 0x7c, 0x7e, 0x78, 0x7e, 0x7c, 0x7e,
+        0x40, 0x7e, 0x7c, 0x7e, 0x78, 0x7e, 0x7c, 0x7e, 0x70, 0x7e, 0x7c, 0x7e, 0x78, 0x7e, 0x7c, 0x7e,
+        0x60, 0x7e, 0x7c, 0x7e, 0x78, 0x7e, 0x7c, 0x7e, 0x70, 0x7e, 0x7c, 0x7e, 0x78, 0x7e, 0x7c, 0x7e
+    },
+};
+
+static const uint64_t DIAGONAL_MASK[64] = {
+    0x8040201008040201ULL, 0x0080402010080402ULL, 0x0000804020100804ULL, 0x0000008040201008ULL,
+    0x0000000080402010ULL, 0x0000000000804020ULL, 0x0000000000008040ULL, 0x0000000000000080ULL,
+    0x4020100804020100ULL, 0x8040201008040201ULL, 0x0080402010080402ULL, 0x0000804020100804ULL,
+    0x0000008040201008ULL, 0x0000000080402010ULL, 0x0000000000804020ULL, 0x0000000000008040ULL,
+    0x2010080402010000ULL, 0x4020100804020100ULL, 0x8040201008040201ULL, 0x0080402010080402ULL,
+    0x0000804020100804ULL, 0x0000008040201008ULL, 0x0000000080402010ULL, 0x0000000000804020ULL,
+    0x1008040201000000ULL, 0x2010080402010000ULL, 0x4020100804020100ULL, 0x8040201008040201ULL,
+    0x0080402010080402ULL, 0x0000804020100804ULL, 0x0000008040201008ULL, 0x0000000080402010ULL,
+    0x0804020100000000ULL, 0x1008040201000000ULL, 0x2010080402010000ULL, 0x4020100804020100ULL,
+    0x8040201008040201ULL, 0x0080402010080402ULL, 0x0000804020100804ULL, 0x0000008040201008ULL,
+    0x0402010000000000ULL, 0x0804020100000000ULL, 0x1008040201000000ULL, 0x2010080402010000ULL,
+    0x4020100804020100ULL, 0x8040201008040201ULL, 0x0080402010080402ULL, 0x0000804020100804ULL,
+    0x0201000000000000ULL, 0x0402010000000000ULL, 0x0804020100000000ULL, 0x1008040201000000ULL,
+    0x2010080402010000ULL, 0x4020100804020100ULL, 0x8040201008040201ULL, 0x0080402010080402ULL,
+    0x0100000000000000ULL, 0x0201000000000000ULL, 0x0402010000000000ULL, 0x0804020100000000ULL,
+    0x1008040201000000ULL, 0x2010080402010000ULL, 0x4020100804020100ULL, 0x8040201008040201ULL,
+};
+
+static const uint64_t ANTI_DIAGONAL_MASK[64] = {
+    0x0000000000000001ULL, 0x0000000000000102ULL, 0x0000000000010204ULL, 0x0000000001020408ULL,
+    0x0000000102040810ULL, 0x0000010204081020ULL, 0x0001020408102040ULL, 0x0102040810204080ULL,
+    0x0000000000000102ULL, 0x0000000000010204ULL, 0x0000000001020408ULL, 0x0000000102040810ULL,
+    0x0000010204081020ULL, 0x0001020408102040ULL, 0x0102040810204080ULL, 0x0204081020408000ULL,
+    0x0000000000010204ULL, 0x0000000001020408ULL, 0x0000000102040810ULL, 0x0000010204081020ULL,
+    0x0001020408102040ULL, 0x0102040810204080ULL, 0x0204081020408000ULL, 0x0408102040800000ULL,
+    0x0000000001020408ULL, 0x0000000102040810ULL, 0x0000010204081020ULL, 0x0001020408102040ULL,
+    0x0102040810204080ULL, 0x0204081020408000ULL, 0x0408102040800000ULL, 0x0810204080000000ULL,
+    0x0000000102040810ULL, 0x0000010204081020ULL, 0x0001020408102040ULL, 0x0102040810204080ULL,
+    0x0204081020408000ULL, 0x0408102040800000ULL, 0x0810204080000000ULL, 0x1020408000000000ULL,
+    0x0000010204081020ULL, 0x0001020408102040ULL, 0x0102040810204080ULL, 0x0204081020408000ULL,
+    0x0408102040800000ULL, 0x0810204080000000ULL, 0x1020408000000000ULL, 0x2040800000000000ULL,
+    0x0001020408102040ULL, 0x0102040810204080ULL, 0x0204081020408000ULL, 0x0408102040800000ULL,
+    0x0810204080000000ULL, 0x1020408000000000ULL, 0x2040800000000000ULL, 0x4080000000000000ULL,
+    0x0102040810204080ULL, 0x0204081020408000ULL, 0x0408102040800000ULL, 0x0810204080000000ULL,
+    0x1020408000000000ULL, 0x2040800000000000ULL, 0x4080000000000000ULL, 0x8000000000000000ULL,
+};
+
+#endif
@@ -0,0 +1,148 @@
+/************************************************************************
+ *
+ *  Generates flip_tables.h, the lookup tables get_flips in board.c uses to
+ *  find the discs flipped by a move without walking the board.
+ *
+ *  Every line through a square (its rank, file, diagonal and anti-diagonal) is
+ *  gathered into a byte indexed by column, or by row for the file. For the
+ *  square's position in that byte:
+ *      - OUTFLANK[pos][o] holds the first square past the run of opponent
+ *        discs on either side of pos, where o is bits 1-6 of the opponent's
+ *        line. A player's disc on one of these squares outflanks the run.
+ *      - FLIPPED[pos][outflank] holds the squares strictly between pos and
+ *        the outflanking discs, which are the discs the move flips.
+ *  DIAGONAL_MASK and ANTI_DIAGONAL_MASK hold the diagonals through each square.
+ *
+ *  The tables are generated ahead of time so nothing is built at startup.
+ *  The library Makefile regenerates them whenever this file changes.
+ *
+ ************************************************************************/
+#include <stdint.h>
+#include <stdio.h>
+
+#define BOARD_SIZE 8
+
+/**
+ * Returns the outflanking squares for a disc at pos in a line whose opponent
+ * discs are given by the inner six bits o.
+ *
+ * @param pos position of the new disc in the line
+ * @param o opponent discs on squares 1-6 of the line
+ * @return bitmask of the outflanking squares
+ */
+int outflank(int pos, int o) {
+    int line = o << 1;
+    int result = 0;
+    int i;
+
+    /* towards the higher squares */
+    for (i = pos + 1; i < BOARD_SIZE && (line & (1 << i)); i++)
+        ;
+    if (i > pos + 1 && i < BOARD_SIZE) {
+        result |= 1 << i;
+    }
+
+    /* towards the lower squares */
+    for (i = pos - 1; i >= 0 && (line & (1 << i)); i--)
+        ;
+    if (i < pos - 1 && i >= 0) {
+        result |= 1 << i;
+    }
+
+    return result;
+}
+
+/**
+ * Returns the squares flipped by a disc at pos given the outflanking squares.
+ *
+ * @param pos position of the new disc in the line
+ * @param outflank bitmask of the outflanking squares
+ * @return bitmask of the flipped squares
+ */
+int flipped(int pos, int outflank) {
+    int result = 0;
+
+    for (int i = 0; i < BOARD_SIZE; i++) {
+        if (!(outflank & (1 << i))) {
+            continue;
+        }
+
+        int lo = (i < pos) ? i : pos;
+        int hi = (i < pos) ? pos : i;
+
+        for (int j = lo + 1; j < hi; j++) {
+            result |= 1 << j;
+        }
+    }
+
+    return result;
+}
+
+/**
+ * Returns the mask of the diagonal running through the given square in the
+ * given column direction (1 for the diagonal, -1 for the anti-diagonal).
+ *
+ * @param square square on the diagonal
+ * @param dcol column step per row
+ * @return bitmask of the diagonal
+ */
+uint64_t diagonal_mask(int square, int dcol) {
+    int row = square / BOARD_SIZE;
+    int col = square % BOARD_SIZE;
+    uint64_t mask = 0;
+
+    for (int i = -BOARD_SIZE; i <= BOARD_SIZE; i++) {
+        int r = row + i;
+        int c = col + i * dcol;
+
+        if (r >= 0 && r < BOARD_SIZE && c >= 0 && c < BOARD_SIZE) {
+            mask |= 1ULL << (r * BOARD_SIZE + c);
+        }
+    }
+
+    return mask;
+}
+
+void print_mask_table(const char *name, int dcol) {
+    printf("static const uint64_t %s[%d] = {\n", name, BOARD_SIZE * BOARD_SIZE);
+    for (int square = 0; square < BOARD_SIZE * BOARD_SIZE; square++) {
+        printf("%s0x%016llxULL,%s", (square % 4 == 0) ? "    " : "",
+               (unsigned long long)diagonal_mask(square, dcol),
+               (square % 4 == 3) ? "\n" : " ");
+    }
+    printf("};\n\n");
+}
+
+int main(void) {
+    printf("/* Generated by gen_flip_tables.c, do not edit. */\n");
+    printf("#ifndef FLIP_TABLES_H\n#define FLIP_TABLES_H\n\n");
+    printf("#include <stdint.h>\n\n");
+
+    printf("static const uint8_t OUTFLANK[%d][64] = {\n", BOARD_SIZE);
+    for (int pos = 0; pos < BOARD_SIZE; pos++) {
+        printf("    {");
+        for (int o = 0; o < 64; o++) {
+            printf("%s0x%02x%s", (o % 16 == 0) ? "\n        " : "", outflank(pos, o),
+                   (o < 63) ? (o % 16 == 15 ? "," : ", ") : "");
+        }
+        printf("\n    },\n");
+    }
+    printf("};\n\n");
+
+    printf("static const uint8_t FLIPPED[%d][256] = {\n", BOARD_SIZE);
+    for (int pos = 0; pos < BOARD_SIZE; pos++) {
+        printf("    {");
+        for (int o = 0; o < 256; o++) {
+            printf("%s0x%02x%s", (o % 16 == 0) ? "\n        " : "", flipped(pos, o),
+                   (o < 255) ? (o % 16 == 15 ? "," : ", ") : "");
+        }
+        printf("\n    },\n");
+    }
+    printf("};\n\n");
+
+    print_mask_table("DIAGONAL_MASK", 1);
+    print_mask_table("ANTI_DIAGONAL_MASK", -1);
+
+    printf("#endif\n");
+    return 0;
+}
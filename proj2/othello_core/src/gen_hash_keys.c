@@ -0,0 +1,54 @@
+/************************************************************************
+ *
+ *  Generates hash_keys.h, the Zobrist keys hash.c uses to hash positions.
+ *
+ *  HASH_KEYS[0][square] is xored into a key for a disc of the side to move on
+ *  the square and HASH_KEYS[1][square] for a disc of the other side. Keys are
+ *  generated for the largest board, and smaller boards use the first squares.
+ *
+ *  The keys come from a fixed seed and are generated ahead of time, so every
+ *  rank, every build and any file of stored keys agree on them. The library
+ *  Makefile regenerates them whenever this file changes.
+ *
+ ************************************************************************/
+#include <stdint.h>
+#include <stdio.h>
+
+#define MAX_SQUARES 100
+#define SEED 0x9e3779b97f4a7c15ULL
+
+/**
+ * Returns the next number from a splitmix64 generator.
+ *
+ * @param state generator state, advanced on every call
+ * @return the next 64-bit number
+ */
+uint64_t next_key(uint64_t *state) {
+    uint64_t z = (*state += 0x9e3779b97f4a7c15ULL);
+
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+    return z ^ (z >> 31);
+}
+
+int main(void) {
+    uint64_t state = SEED;
+
+    printf("/* Generated by gen_hash_keys.c, do not edit. */\n");
+    printf("#ifndef HASH_KEYS_H\n#define HASH_KEYS_H\n\n");
+    printf("#include <stdint.h>\n\n");
+
+    printf("static const uint64_t HASH_KEYS[2][%d] = {\n", MAX_SQUARES);
+    for (int side = 0; side < 2; side++) {
+        printf("    {");
+        for (int square = 0; square < MAX_SQUARES; square++) {
+            printf("%s0x%016llxULL%s", (square % 4 == 0) ? "\n        " : "",
+                   (unsigned long long)next_key(&state), (square < MAX_SQUARES - 1) ? (square % 4 == 3 ? "," : ", ") : "");
+        }
+        printf("\n    },\n");
+    }
+    printf("};\n\n");
+
+    printf("#endif\n");
+    return 0;
+}
@@ -0,0 +1,139 @@
+/************************************************************************
+ *
+ *  Generates stability_tables.h, the lookup tables get_stable_discs in
+ *  stability.c uses to find the stable discs on the edges of the board.
+ *
+ *  A disc on an edge can only be flipped along that edge, so whether it is
+ *  stable depends on the edge alone. Each edge is read as a line of eight
+ *  squares holding a player's disc, an opponent's disc or nothing, which
+ *  gives 3^8 configurations:
+ *      - BASE3[b] spreads the byte b into base 3, so a line is indexed by
+ *        BASE3[player] + 2 * BASE3[opponent].
+ *      - EDGE_STABILITY[index] holds the player's discs in the line that no
+ *        sequence of moves along the line can flip.
+ *
+ *  The tables are generated ahead of time so nothing is built at startup.
+ *  The library Makefile regenerates them whenever this file changes.
+ *
+ ************************************************************************/
+#include <stdint.h>
+#include <stdio.h>
+
+#define BOARD_SIZE 8
+#define EDGE_CONFIGURATIONS 6561
+
+/**
+ * Returns the discs flipped along the line by the player placing a disc on
+ * square x.
+ *
+ * @param player player's discs in the line
+ * @param opponent opponent's discs in the line
+ * @param x square the disc is placed on
+ * @return bitmask of the flipped discs
+ */
+int line_flips(int player, int opponent, int x) {
+    int flips = 0;
+    int run = 0;
+    int i;
+
+    /* towards the higher squares */
+    for (i = x + 1; i < BOARD_SIZE && (opponent & (1 << i)); i++) {
+        run |= 1 << i;
+    }
+    if (i < BOARD_SIZE && (player & (1 << i))) {
+        flips |= run;
+    }
+
+    /* towards the lower squares */
+    run = 0;
+    for (i = x - 1; i >= 0 && (opponent & (1 << i)); i--) {
+        run |= 1 << i;
+    }
+    if (i >= 0 && (player & (1 << i))) {
+        flips |= run;
+    }
+
+    return flips;
+}
+
+/**
+ * Narrows the candidate stable discs to those that survive every sequence of
+ * moves along the line. Either side may play any empty square, legal or not,
+ * which only makes the result more cautious.
+ *
+ * @param player player's discs in the line
+ * @param opponent opponent's discs in the line
+ * @param stable candidate stable discs
+ * @return the candidates that are never flipped
+ */
+int edge_stable(int player, int opponent, int stable) {
+    int empty = ~(player | opponent) & 0xff;
+
+    stable &= player;
+
+    for (int x = 0; x < BOARD_SIZE && stable; x++) {
+        if (!(empty & (1 << x))) {
+            continue;
+        }
+
+        /* the player plays x, which can only take discs from the opponent */
+        int flips = line_flips(player, opponent, x);
+        stable = edge_stable(player | flips | (1 << x), opponent & ~flips, stable);
+
+        /* the opponent plays x and may take some of the candidates */
+        flips = line_flips(opponent, player, x);
+        stable = edge_stable(player & ~flips, opponent | flips | (1 << x), stable);
+    }
+
+    return stable;
+}
+
+/**
+ * Spreads the bits of a byte into base 3.
+ *
+ * @param b byte to spread
+ * @return b read as a base 3 number
+ */
+int base3(int b) {
+    int result = 0;
+
+    for (int i = BOARD_SIZE - 1; i >= 0; i--) {
+        result = result * 3 + ((b >> i) & 1);
+    }
+
+    return result;
+}
+
+int main(void) {
+    static uint8_t stability[EDGE_CONFIGURATIONS];
+
+    for (int player = 0; player < 256; player++) {
+        for (int opponent = 0; opponent < 256; opponent++) {
+            if (player & opponent) {
+                continue;
+            }
+
+            stability[base3(player) + 2 * base3(opponent)] = (uint8_t)edge_stable(player, opponent, player);
+        }
+    }
+
+    printf("/* Generated by gen_stability_tables.c, do not edit. */\n");
+    printf("#ifndef STABILITY_TABLES_H\n#define STABILITY_TABLES_H\n\n");
+    printf("#include <stdint.h>\n\n");
+
+    printf("static const uint16_t BASE3[256] = {");
+    for (int b = 0; b < 256; b++) {
+        printf("%s%d%s", (b % 16 == 0) ? "\n    " : "", base3(b), (b < 255) ? (b % 16 == 15 ? "," : ", ") : "");
+    }
+    printf("\n};\n\n");
+
+    printf("static const uint8_t EDGE_STABILITY[%d] = {", EDGE_CONFIGURATIONS);
+    for (int i = 0; i < EDGE_CONFIGURATIONS; i++) {
+        printf("%s0x%02x%s", (i % 16 == 0) ? "\n    " : "", stability[i],
+               (i < EDGE_CONFIGURATIONS - 1) ? (i % 16 == 15 ? "," : ", ") : "");
+    }
+    printf("\n};\n\n");
+
+    printf("#endif\n");
+    return 0;
+}
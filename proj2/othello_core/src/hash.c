@@ -0,0 +1,67 @@
+/************************************************************************
+ *
+ *  Zobrist hashing of positions. A key is the xor of one random number per
+ *  disc, chosen by the disc's square and by whether it belongs to the side to
+ *  move, so it can be updated from the squares a move changes.
+ *
+ ************************************************************************/
+#include "othello.h"
+#include "hash_keys.h"
+
+/**
+ * Hashes a position from scratch. Search code hashes the root once and
+ * follows the moves played from it with hash_move.
+ *
+ * @param pos position to hash, viewed from the side to move
+ * @return the keys of the position and of its swapped view
+ */
+HashKey hash_position(const Position *pos) {
+    HashKey hash = {0, 0};
+
+    for (Bitboard discs = pos->player; discs; discs &= discs - 1) {
+        int square = first_square(discs);
+
+        hash.key ^= HASH_KEYS[0][square];
+        hash.swapped ^= HASH_KEYS[1][square];
+    }
+
+    for (Bitboard discs = pos->opponent; discs; discs &= discs - 1) {
+        int square = first_square(discs);
+
+        hash.key ^= HASH_KEYS[1][square];
+        hash.swapped ^= HASH_KEYS[0][square];
+    }
+
+    return hash;
+}
+
+/**
+ * Updates the keys for a move played by the side to move, as play_move does
+ * for the position. A flipped disc changes sides, which xors both of its
+ * square's keys into either view, so the work is one xor per changed square.
+ * The views are then swapped, as the opponent is now to move.
+ *
+ * @param hash keys to update
+ * @param move square the disc was placed on, or -1 for a pass
+ * @param flips discs the move flipped
+ */
+void hash_move(HashKey *hash, int move, Bitboard flips) {
+    uint64_t key = hash->key;
+    uint64_t swapped = hash->swapped;
+
+    if (move >= 0) {
+        key ^= HASH_KEYS[0][move];
+        swapped ^= HASH_KEYS[1][move];
+
+        for (; flips; flips &= flips - 1) {
+            int square = first_square(flips);
+            uint64_t change = HASH_KEYS[0][square] ^ HASH_KEYS[1][square];
+
+            key ^= change;
+            swapped ^= change;
+        }
+    }
+
+    hash->key = swapped;
+    hash->swapped = key;
+}
@@ -0,0 +1,420 @@
+/************************************************************************
+ *
+ *  Move generation: the mobility kernels, their runtime dispatch and
+ *  self-check, and batched expansion of all children of a position.
+ *
+ ************************************************************************/
+#include "othello.h"
+
+/* the vectorised kernels are written for 8x8 boards */
+#if defined(__x86_64__) && BOARD_SIZE == 8
+#include <immintrin.h>
+#define HAVE_X86_KERNELS
+#endif
+
+/* mobility kernel chosen for this CPU by select_move_kernel */
+Bitboard (*get_moves)(Bitboard, Bitboard) = get_moves_scalar;
+void (*get_moves_batch)(const Bitboard *, const Bitboard *, Bitboard *, int) = get_moves_batch_scalar;
+const char *move_kernel_name = "scalar";
+
+/* positions the kernels are checked on at startup */
+Bitboard check_player[KERNEL_CHECK_POSITIONS];
+Bitboard check_opponent[KERNEL_CHECK_POSITIONS];
+
+/**
+ * Returns the bitboard of legal moves for the player. A move is legal when it
+ * sandwiches at least one of the opponent's discs between the piece being
+ * placed and another of the player's discs, so the opponent's discs adjacent
+ * to the player are extended along each direction (at most BOARD_SIZE - 2 in
+ * a row) and
+ * the first empty square past each run is a legal move.
+ *
+ * This is the reference kernel that the vectorised kernels are checked
+ * against, and the fallback on CPUs without them.
+ *
+ * @param player bitboard of the player to move
+ * @param opponent bitboard of the opponent
+ * @return bitboard of the legal moves
+ */
+Bitboard get_moves_scalar(Bitboard player, Bitboard opponent) {
+    Bitboard empty = ~(player | opponent);
+    Bitboard moves = 0;
+
+    for (int dir = 0; dir < 8; dir++) {
+        Bitboard candidates = shift_discs(player, dir) & opponent;
+
+        for (int i = 0; i < BOARD_SIZE - 3; i++) {
+            candidates |= shift_discs(candidates, dir) & opponent;
+        }
+
+        moves |= shift_discs(candidates, dir) & empty;
+    }
+
+    return moves;
+}
+
+#ifdef HAVE_X86_KERNELS
+/*
+ * The vectorised kernels run one Kogge-Stone fill per lane. Masking the
+ * opponent's discs to the inner files (and ranks, where a rotate is used)
+ * stops runs from wrapping around the board, and the second fill step reuses
+ * pairs of opponent discs to extend the runs two squares at a time.
+ */
+#define KOGGE_STONE_MOVES(OR, AND, SHIFT, PP, MOO, s, s2, moves)                 \
+    do {                                                                       \
+        __typeof__(PP) flip_ = AND(MOO, SHIFT(PP, s));                          \
+        __typeof__(PP) pre_ = AND(MOO, SHIFT(MOO, s));                          \
+        flip_ = OR(flip_, AND(MOO, SHIFT(flip_, s)));                           \
+        flip_ = OR(flip_, AND(pre_, SHIFT(flip_, s2)));                         \
+        flip_ = OR(flip_, AND(pre_, SHIFT(flip_, s2)));                         \
+        moves = OR(moves, SHIFT(flip_, s));                                     \
+    } while (0)
+
+/**
+ * SSE2 mobility kernel. Lane 0 holds the board and lane 1 the board flipped
+ * vertically, so a left shift in lane 1 runs towards the top of the real
+ * board. Five two-lane fills cover all eight directions.
+ *
+ * @param player bitboard of the player to move
+ * @param opponent bitboard of the opponent
+ * @return bitboard of the legal moves
+ */
+__attribute__((target("sse2")))
+uint64_t get_moves_sse2(uint64_t player, uint64_t opponent) {
+    __m128i PP = _mm_set_epi64x((long long)__builtin_bswap64(player), (long long)player);
+    __m128i OO = _mm_set_epi64x((long long)__builtin_bswap64(opponent), (long long)opponent);
+    __m128i MOO = _mm_and_si128(OO, _mm_set1_epi64x((long long)INNER_FILES));
+    __m128i moves = _mm_setzero_si128();
+
+    KOGGE_STONE_MOVES(_mm_or_si128, _mm_and_si128, _mm_slli_epi64, PP, MOO, 1, 2, moves);
+    KOGGE_STONE_MOVES(_mm_or_si128, _mm_and_si128, _mm_srli_epi64, PP, MOO, 1, 2, moves);
+    KOGGE_STONE_MOVES(_mm_or_si128, _mm_and_si128, _mm_slli_epi64, PP, MOO, 7, 14, moves);
+    KOGGE_STONE_MOVES(_mm_or_si128, _mm_and_si128, _mm_slli_epi64, PP, OO, 8, 16, moves);
+    KOGGE_STONE_MOVES(_mm_or_si128, _mm_and_si128, _mm_slli_epi64, PP, MOO, 9, 18, moves);
+
+    uint64_t down = (uint64_t)_mm_cvtsi128_si64(moves);
+    uint64_t up = (uint64_t)_mm_cvtsi128_si64(_mm_unpackhi_epi64(moves, moves));
+
+    return (down | __builtin_bswap64(up)) & ~(player | opponent);
+}
+
+/**
+ * AVX2 mobility kernel. The four lanes shift by 1, 8, 9 and 7 squares, once
+ * to the left and once to the right, covering all eight directions.
+ *
+ * @param player bitboard of the player to move
+ * @param opponent bitboard of the opponent
+ * @return bitboard of the legal moves
+ */
+__attribute__((target("avx2")))
+uint64_t get_moves_avx2(uint64_t player, uint64_t opponent) {
+    const __m256i shift = _mm256_set_epi64x(7, 9, 8, 1);
+    const __m256i shift2 = _mm256_set_epi64x(14, 18, 16, 2);
+    const __m256i mask = _mm256_set_epi64x((long long)INNER_FILES, (long long)INNER_FILES, -1, (long long)INNER_FILES);
+    __m256i PP = _mm256_set1_epi64x((long long)player);
+    __m256i MOO = _mm256_and_si256(_mm256_set1_epi64x((long long)opponent), mask);
+    __m256i moves = _mm256_setzero_si256();
+
+    KOGGE_STONE_MOVES(_mm256_or_si256, _mm256_and_si256, _mm256_sllv_epi64, PP, MOO, shift, shift2, moves);
+    KOGGE_STONE_MOVES(_mm256_or_si256, _mm256_and_si256, _mm256_srlv_epi64, PP, MOO, shift, shift2, moves);
+
+    __m128i half = _mm_or_si128(_mm256_castsi256_si128(moves), _mm256_extracti128_si256(moves, 1));
+    half = _mm_or_si128(half, _mm_unpackhi_epi64(half, half));
+
+    return (uint64_t)_mm_cvtsi128_si64(half) & ~(player | opponent);
+}
+
+/**
+ * AVX-512 mobility kernel. Each of the eight lanes rotates towards one
+ * direction, a right shift being a left rotate by the complement. Masking the
+ * opponent's discs to the inner ranks keeps the rotates from wrapping.
+ *
+ * @param player bitboard of the player to move
+ * @param opponent bitboard of the opponent
+ * @return bitboard of the legal moves
+ */
+__attribute__((target("avx512f")))
+uint64_t get_moves_avx512(uint64_t player, uint64_t opponent) {
+    const __m512i shift = _mm512_set_epi64(57, 55, 56, 63, 7, 9, 8, 1);
+    const __m512i shift2 = _mm512_set_epi64(50, 46, 48, 62, 14, 18, 16, 2);
+    const __m512i mask = _mm512_set_epi64((long long)INNER_SQUARES, (long long)INNER_SQUARES, (long long)INNER_RANKS, (long long)INNER_FILES,
+                                          (long long)INNER_SQUARES, (long long)INNER_SQUARES, (long long)INNER_RANKS, (long long)INNER_FILES);
+    __m512i PP = _mm512_set1_epi64((long long)player);
+    __m512i MOO = _mm512_and_si512(_mm512_set1_epi64((long long)opponent), mask);
+    __m512i moves = _mm512_setzero_si512();
+
+    KOGGE_STONE_MOVES(_mm512_or_si512, _mm512_and_si512, _mm512_rolv_epi64, PP, MOO, shift, shift2, moves);
+
+    return (uint64_t)_mm512_reduce_or_epi64(moves) & ~(player | opponent);
+}
+
+/*
+ * The batched kernels give each lane a different position and run the eight
+ * directions one after the other, so the shifts are immediates.
+ */
+#define BATCH_MOVES(OR, AND, SHL, SHR, PP, OO, MOO, moves)                      \
+    do {                                                                       \
+        KOGGE_STONE_MOVES(OR, AND, SHL, PP, MOO, 1, 2, moves);                  \
+        KOGGE_STONE_MOVES(OR, AND, SHR, PP, MOO, 1, 2, moves);                  \
+        KOGGE_STONE_MOVES(OR, AND, SHL, PP, MOO, 7, 14, moves);                 \
+        KOGGE_STONE_MOVES(OR, AND, SHR, PP, MOO, 7, 14, moves);                 \
+        KOGGE_STONE_MOVES(OR, AND, SHL, PP, OO, 8, 16, moves);                  \
+        KOGGE_STONE_MOVES(OR, AND, SHR, PP, OO, 8, 16, moves);                  \
+        KOGGE_STONE_MOVES(OR, AND, SHL, PP, MOO, 9, 18, moves);                 \
+        KOGGE_STONE_MOVES(OR, AND, SHR, PP, MOO, 9, 18, moves);                 \
+    } while (0)
+
+/**
+ * SSE2 batched mobility kernel, two positions per step.
+ *
+ * @param player bitboards of the players to move
+ * @param opponent bitboards of the opponents
+ * @param moves array to store the legal moves of each position in
+ * @param count number of positions
+ */
+__attribute__((target("sse2")))
+void get_moves_batch_sse2(const uint64_t *player, const uint64_t *opponent, uint64_t *moves, int count) {
+    const __m128i inner = _mm_set1_epi64x((long long)INNER_FILES);
+
+    for (int i = 0; i < count; i += 2) {
+        __m128i PP = _mm_loadu_si128((const __m128i *)(player + i));
+        __m128i OO = _mm_loadu_si128((const __m128i *)(opponent + i));
+        __m128i MOO = _mm_and_si128(OO, inner);
+        __m128i mobility = _mm_setzero_si128();
+
+        BATCH_MOVES(_mm_or_si128, _mm_and_si128, _mm_slli_epi64, _mm_srli_epi64, PP, OO, MOO, mobility);
+
+        _mm_storeu_si128((__m128i *)(moves + i), _mm_andnot_si128(_mm_or_si128(PP, OO), mobility));
+    }
+}
+
+/**
+ * AVX2 batched mobility kernel, four positions per step.
+ *
+ * @param player bitboards of the players to move
+ * @param opponent bitboards of the opponents
+ * @param moves array to store the legal moves of each position in
+ * @param count number of positions
+ */
+__attribute__((target("avx2")))
+void get_moves_batch_avx2(const uint64_t *player, const uint64_t *opponent, uint64_t *moves, int count) {
+    const __m256i inner = _mm256_set1_epi64x((long long)INNER_FILES);
+
+    for (int i = 0; i < count; i += 4) {
+        __m256i PP = _mm256_loadu_si256((const __m256i *)(player + i));
+        __m256i OO = _mm256_loadu_si256((const __m256i *)(opponent + i));
+        __m256i MOO = _mm256_and_si256(OO, inner);
+        __m256i mobility = _mm256_setzero_si256();
+
+        BATCH_MOVES(_mm256_or_si256, _mm256_and_si256, _mm256_slli_epi64, _mm256_srli_epi64, PP, OO, MOO, mobility);
+
+        _mm256_storeu_si256((__m256i *)(moves + i), _mm256_andnot_si256(_mm256_or_si256(PP, OO), mobility));
+    }
+}
+
+/**
+ * AVX-512 batched mobility kernel, eight positions per step.
+ *
+ * @param player bitboards of the players to move
+ * @param opponent bitboards of the opponents
+ * @param moves array to store the legal moves of each position in
+ * @param count number of positions
+ */
+__attribute__((target("avx512f")))
+void get_moves_batch_avx512(const uint64_t *player, const uint64_t *opponent, uint64_t *moves, int count) {
+    const __m512i inner = _mm512_set1_epi64((long long)INNER_FILES);
+
+    for (int i = 0; i < count; i += 8) {
+        __m512i PP = _mm512_loadu_si512((const void *)(player + i));
+        __m512i OO = _mm512_loadu_si512((const void *)(opponent + i));
+        __m512i MOO = _mm512_and_si512(OO, inner);
+        __m512i mobility = _mm512_setzero_si512();
+
+        BATCH_MOVES(_mm512_or_si512, _mm512_and_si512, _mm512_slli_epi64, _mm512_srli_epi64, PP, OO, MOO, mobility);
+
+        _mm512_storeu_si512((void *)(moves + i), _mm512_andnot_si512(_mm512_or_si512(PP, OO), mobility));
+    }
+}
+#endif
+
+/**
+ * Batched mobility kernel for CPUs without vector support. The batch may be
+ * padded up to a whole number of lanes; padding positions are computed too.
+ *
+ * @param player bitboards of the players to move
+ * @param opponent bitboards of the opponents
+ * @param moves array to store the legal moves of each position in
+ * @param count number of positions
+ */
+void get_moves_batch_scalar(const Bitboard *player, const Bitboard *opponent, Bitboard *moves, int count) {
+    for (int i = 0; i < count; i++) {
+        moves[i] = get_moves_scalar(player[i], opponent[i]);
+    }
+}
+
+/**
+ * Generates every child of a position in one pass: the child positions, the
+ * number of discs each move flips, and the legal moves of the side to move in
+ * each child. The child mobility is computed with the batched kernel, several
+ * children per vector.
+ *
+ * @param pos position to expand
+ * @param mobility legal moves of the side to move in pos
+ * @param batch batch to store the children in
+ */
+void generate_children(Position *pos, Bitboard mobility, ChildBatch *batch) {
+    int count = 0;
+
+    while (mobility) {
+        int square = first_square(mobility);
+        Bitboard flips = get_flips(pos->player, pos->opponent, square);
+
+        batch->square[count] = square;
+        batch->flip_count[count] = count_discs(flips);
+        batch->player[count] = pos->opponent ^ flips;
+        batch->opponent[count] = pos->player | flips | SQUARE_BIT(square);
+        count++;
+
+        mobility &= mobility - 1;
+    }
+
+    batch->count = count;
+
+    /* pad to whole lanes so the kernels never read past the children */
+    int padded = (count + BATCH_LANES - 1) / BATCH_LANES * BATCH_LANES;
+
+    for (int i = count; i < padded; i++) {
+        batch->player[i] = 0;
+        batch->opponent[i] = 0;
+    }
+
+    get_moves_batch(batch->player, batch->opponent, batch->mobility, padded);
+}
+
+/**
+ * Fills the given arrays with positions for the kernel self-checks, taken
+ * alternately from random playouts and random disc masks. Random masks reach
+ * shapes that playouts rarely do.
+ *
+ * @param player array to store the players' bitboards in
+ * @param opponent array to store the opponents' bitboards in
+ * @param count number of positions to generate
+ */
+void generate_check_positions(Bitboard *player, Bitboard *opponent, int count) {
+    uint64_t seed = 0x9e3779b97f4a7c15ULL;
+    Position pos = start_position();
+
+    for (int i = 0; i < count; i++) {
+        seed ^= seed << 13;
+        seed ^= seed >> 7;
+        seed ^= seed << 17;
+
+        if (i % 2) {
+            Bitboard mine = ((Bitboard)seed << 32) ^ seed;
+            Bitboard other = mine * 0x2545f4914f6cdd1dULL;
+
+            player[i] = mine & ~other & FULL_BOARD;
+            opponent[i] = other & ~mine & FULL_BOARD;
+            continue;
+        }
+
+        player[i] = pos.player;
+        opponent[i] = pos.opponent;
+
+        Bitboard moves = get_moves_scalar(pos.player, pos.opponent);
+
+        if (moves == 0) {
+            if (get_moves_scalar(pos.opponent, pos.player) == 0) {
+                pos = start_position();
+            } else {
+                play_move(&pos, -1);
+            }
+            continue;
+        }
+
+        /* play the n-th legal move, picked by the random stream */
+        for (int n = (int)(seed % (uint64_t)count_discs(moves)); n > 0; n--) {
+            moves &= moves - 1;
+        }
+
+        play_move(&pos, first_square(moves));
+    }
+}
+
+/**
+ * Checks a mobility kernel against the scalar kernel.
+ *
+ * @param kernel kernel to check
+ * @return 1 if every move mask matches, 0 otherwise
+ */
+int check_move_kernel(Bitboard (*kernel)(Bitboard, Bitboard)) {
+    generate_check_positions(check_player, check_opponent, KERNEL_CHECK_POSITIONS);
+
+    for (int i = 0; i < KERNEL_CHECK_POSITIONS; i++) {
+        if (kernel(check_player[i], check_opponent[i]) != get_moves_scalar(check_player[i], check_opponent[i])) {
+            return 0;
+        }
+    }
+
+    return 1;
+}
+
+/**
+ * Checks a batched mobility kernel against the scalar kernel.
+ *
+ * @param kernel kernel to check
+ * @return 1 if every move mask matches, 0 otherwise
+ */
+int check_batch_kernel(void (*kernel)(const Bitboard *, const Bitboard *, Bitboard *, int)) {
+    Bitboard moves[BATCH_LANES];
+
+    generate_check_positions(check_player, check_opponent, KERNEL_CHECK_POSITIONS);
+
+    for (int i = 0; i < KERNEL_CHECK_POSITIONS; i += BATCH_LANES) {
+        kernel(check_player + i, check_opponent + i, moves, BATCH_LANES);
+
+        for (int j = 0; j < BATCH_LANES; j++) {
+            if (moves[j] != get_moves_scalar(check_player[i + j], check_opponent[i + j])) {
+                return 0;
+            }
+        }
+    }
+
+    return 1;
+}
+
+/**
+ * Picks the fastest mobility kernels the CPU supports that also pass the
+ * self-check, falling back to the scalar kernels otherwise.
+ */
+void select_move_kernel(void) {
+    get_moves = get_moves_scalar;
+    get_moves_batch = get_moves_batch_scalar;
+    move_kernel_name = "scalar";
+
+#ifdef HAVE_X86_KERNELS
+    __builtin_cpu_init();
+
+    if (__builtin_cpu_supports("sse2") && check_move_kernel(get_moves_sse2) &&
+        check_batch_kernel(get_moves_batch_sse2)) {
+        get_moves = get_moves_sse2;
+        get_moves_batch = get_moves_batch_sse2;
+        move_kernel_name = "sse2";
+    }
+
+    if (__builtin_cpu_supports("avx2") && check_move_kernel(get_moves_avx2) &&
+        check_batch_kernel(get_moves_batch_avx2)) {
+        get_moves = get_moves_avx2;
+        get_moves_batch = get_moves_batch_avx2;
+        move_kernel_name = "avx2";
+    }
+
+    if (__builtin_cpu_supports("avx512f") && check_move_kernel(get_moves_avx512) &&
+        check_batch_kernel(get_moves_batch_avx512)) {
+        get_moves = get_moves_avx512;
+        get_moves_batch = get_moves_batch_avx512;
+        move_kernel_name = "avx512";
+    }
+#endif
+}
+
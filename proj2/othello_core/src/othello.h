@@ -0,0 +1,279 @@
+#ifndef OTHELLO_H
+#define OTHELLO_H
+
+/************************************************************************
+ *
+ *  Othello core library shared by the players and the local referee.
+ *
+ *  Positions are pairs of bitboards, bit (row * BOARD_SIZE + col) being set
+ *  when that square holds a disc, and squares are numbered the same way
+ *  everywhere: 0 is row 0, column 0 and the last square is the bottom right
+ *  corner. A move is a square, or -1 for a pass.
+ *
+ *  The board size is fixed at compile time with -DBOARD_SIZE=6, 8 or 10 and
+ *  defaults to 8. Boards up to 8x8 fit in one 64-bit word and 10x10 boards
+ *  use 128-bit bitboards; every mask below is a constant for the chosen size.
+ *  The vectorised kernels and flip tables are 8x8 only, other sizes use the
+ *  scalar kernels.
+ *
+ *  Mobility kernels are picked for the CPU at startup by select_move_kernel,
+ *  which must be called before get_moves or get_moves_batch are used.
+ *
+ ************************************************************************/
+#include <stddef.h>
+#include <stdint.h>
+
+#ifndef BOARD_SIZE
+#define BOARD_SIZE 8
+#endif
+
+#if BOARD_SIZE != 6 && BOARD_SIZE != 8 && BOARD_SIZE != 10
+#error "BOARD_SIZE must be 6, 8 or 10"
+#endif
+
+#define BOARD_SQUARES (BOARD_SIZE * BOARD_SIZE)
+#define MAX_MOVES BOARD_SQUARES
+
+#if BOARD_SIZE <= 8
+typedef uint64_t Bitboard;
+#else
+__extension__ typedef unsigned __int128 Bitboard;
+#endif
+
+#define SQUARE_BIT(square) ((Bitboard)1 << (square))
+
+#if BOARD_SQUARES == 64
+#define FULL_BOARD (~(Bitboard)0)
+#else
+#define FULL_BOARD (SQUARE_BIT(BOARD_SQUARES) - 1)
+#endif
+
+#define FIRST_RANK (SQUARE_BIT(BOARD_SIZE) - 1)
+#define LAST_RANK (FIRST_RANK << (BOARD_SQUARES - BOARD_SIZE))
+#define A_FILE (FULL_BOARD / FIRST_RANK)
+#define H_FILE (A_FILE << (BOARD_SIZE - 1))
+
+#define NOT_A_FILE (FULL_BOARD & ~A_FILE)
+#define NOT_H_FILE (FULL_BOARD & ~H_FILE)
+#define INNER_FILES (NOT_A_FILE & NOT_H_FILE)
+#define INNER_RANKS (FULL_BOARD & ~(FIRST_RANK | LAST_RANK))
+#define INNER_SQUARES (INNER_FILES & INNER_RANKS)
+
+#define CORNER_SQUARES (SQUARE_BIT(0) | SQUARE_BIT(BOARD_SIZE - 1) | \
+                        SQUARE_BIT(BOARD_SQUARES - BOARD_SIZE) | SQUARE_BIT(BOARD_SQUARES - 1))
+#define EDGE_SQUARES ((FIRST_RANK | LAST_RANK | A_FILE | H_FILE) & ~CORNER_SQUARES)
+
+#define KERNEL_CHECK_POSITIONS 4096
+#define BATCH_LANES 8
+#define BATCH_SIZE ((MAX_MOVES + BATCH_LANES - 1) / BATCH_LANES * BATCH_LANES)
+
+/*
+ * A position is a pair of bitboards. The player mask always belongs to the side
+ * the position is viewed from, so a copy of an 8x8 position is just 16 bytes.
+ */
+typedef struct {
+    Bitboard player;
+    Bitboard opponent;
+} Position;
+
+/*
+ * Zobrist key of a position viewed from the side to move, together with the
+ * key of the same discs viewed from the other side. A move hands the turn
+ * over, so keeping both lets hash_move update the key from the changed
+ * squares alone.
+ */
+typedef struct {
+    uint64_t key;
+    uint64_t swapped;
+} HashKey;
+
+/* which of an entry's bounds hold; an exact score is both bounds at once */
+#define BOUND_NONE 0
+#define BOUND_UPPER 1
+#define BOUND_LOWER 2
+#define BOUND_EXACT (BOUND_UPPER | BOUND_LOWER)
+
+/* stored scores are 16 bits, so scores must stay within this */
+#define TT_SCORE_MAX 32767
+
+/*
+ * A transposition table entry: bounds on the score of a position searched to
+ * some depth, packed into 16 bytes so four share a cache line. Null-window
+ * searches, repeated with different windows, tighten the same entry from
+ * both sides until the bounds meet. The age is the search generation (move)
+ * the entry was last stored or used in.
+ */
+typedef struct {
+    uint64_t key;
+    int16_t lower;
+    int16_t upper;
+    int8_t depth;
+    int8_t move;
+    uint8_t bound;
+    uint8_t age;
+} TTEntry;
+
+/*
+ * State of an exact endgame solve: the nodes searched, added to as the solve
+ * goes, and a time check polled every few thousand nodes that stops the solve
+ * when it returns nonzero. A stopped solve sets stopped and its score means
+ * nothing.
+ */
+typedef struct {
+    long long nodes;
+    int (*time_up)(void);
+    int stopped;
+} EndgameSearch;
+
+/* outcomes of a proof-number search */
+#define PROOF_UNKNOWN 0
+#define PROOF_WIN 1
+#define PROOF_NO_WIN 2
+
+/*
+ * State of a proof-number search: the most tree nodes it may hold, which
+ * bounds its memory, and a time check polled after every expansion. The
+ * search reports the nodes it created and, when it proves a win, the move
+ * that wins.
+ */
+typedef struct {
+    size_t node_budget;
+    int (*time_up)(void);
+    long long nodes;
+    int move;
+} ProofSearch;
+
+/*
+ * An opening book entry: the move to play in the position with the given
+ * hash key, and its score for the side to move: the final disc difference
+ * of game records, or a search score. The depth is how deep the score was
+ * searched, 0 for a score taken from game records, and games how many games
+ * the move was played in, 0 for a searched move.
+ */
+typedef struct {
+    uint64_t key;
+    int16_t score;
+    int8_t move;
+    uint8_t depth;
+    uint32_t games;
+} BookEntry;
+
+/* an opening book mapped into memory, its entries sorted by key */
+typedef struct {
+    const BookEntry *entries;
+    size_t count;
+    void *map;
+    size_t bytes;
+} OpeningBook;
+
+/*
+ * All children of a position, generated in one pass. The children are stored
+ * as separate player and opponent arrays, viewed from the side to move after
+ * the move, so the batched mobility kernels can load several at once. The
+ * arrays are padded to a whole number of vector lanes.
+ */
+typedef struct {
+    Bitboard player[BATCH_SIZE];
+    Bitboard opponent[BATCH_SIZE];
+    Bitboard mobility[BATCH_SIZE];
+    int square[MAX_MOVES];
+    int flip_count[MAX_MOVES];
+    int count;
+} ChildBatch;
+
+/* board.c */
+Position start_position(void);
+Bitboard shift_discs(Bitboard, int);
+Bitboard get_flips(Bitboard, Bitboard, int);
+Bitboard play_move(Position *, int);
+void undo_move(Position *, int, Bitboard);
+int list_moves(Bitboard, int *);
+int get_loc(const char *);
+void get_move_string(int, char *);
+
+/* stability.c */
+Bitboard get_stable_discs(Bitboard, Bitboard);
+
+/* hash.c */
+HashKey hash_position(const Position *);
+void hash_move(HashKey *, int, Bitboard);
+
+/* cache.c */
+void *allocate_cache(size_t);
+void free_cache(void *, size_t);
+
+/* ttable.c */
+int init_transposition_table(size_t);
+size_t transposition_table_size(void);
+void clear_transposition_table(void);
+void age_transposition_table(void);
+void prefetch_transposition(uint64_t);
+TTEntry *probe_transposition(uint64_t);
+void store_transposition(uint64_t, int, int, int, int);
+
+/* endgame.c */
+int solve_endgame(const Position *, int, int, EndgameSearch *);
+
+/* proof.c */
+int prove_win(const Position *, ProofSearch *);
+
+/* book.c */
+int open_book(OpeningBook *, const char *);
+void close_book(OpeningBook *);
+const BookEntry *probe_book(const OpeningBook *, uint64_t);
+int write_book(const char *, BookEntry *, size_t);
+
+/* movegen.c */
+Bitboard get_moves_scalar(Bitboard, Bitboard);
+Bitboard get_moves_sse2(Bitboard, Bitboard);
+Bitboard get_moves_avx2(Bitboard, Bitboard);
+Bitboard get_moves_avx512(Bitboard, Bitboard);
+void get_moves_batch_scalar(const Bitboard *, const Bitboard *, Bitboard *, int);
+void get_moves_batch_sse2(const Bitboard *, const Bitboard *, Bitboard *, int);
+void get_moves_batch_avx2(const Bitboard *, const Bitboard *, Bitboard *, int);
+void get_moves_batch_avx512(const Bitboard *, const Bitboard *, Bitboard *, int);
+void generate_children(Position *, Bitboard, ChildBatch *);
+void select_move_kernel(void);
+void generate_check_positions(Bitboard *, Bitboard *, int);
+int check_move_kernel(Bitboard (*)(Bitboard, Bitboard));
+int check_batch_kernel(void (*)(const Bitboard *, const Bitboard *, Bitboard *, int));
+
+/* mobility kernels chosen for this CPU by select_move_kernel */
+extern Bitboard (*get_moves)(Bitboard, Bitboard);
+extern void (*get_moves_batch)(const Bitboard *, const Bitboard *, Bitboard *, int);
+extern const char *move_kernel_name;
+
+/* how allocate_cache backed the last cache it mapped */
+extern const char *cache_memory_name;
+
+/**
+ * Counts the discs in the given bitboard.
+ *
+ * @param discs bitboard to count
+ * @return number of discs
+ */
+static inline int count_discs(Bitboard discs) {
+#if BOARD_SIZE <= 8
+    return __builtin_popcountll(discs);
+#else
+    return __builtin_popcountll((uint64_t)discs) + __builtin_popcountll((uint64_t)(discs >> 64));
+#endif
+}
+
+/**
+ * Returns the lowest square set in a non-empty bitboard.
+ *
+ * @param discs bitboard to scan
+ * @return square of the lowest disc
+ */
+static inline int first_square(Bitboard discs) {
+#if BOARD_SIZE <= 8
+    return __builtin_ctzll(discs);
+#else
+    uint64_t low = (uint64_t)discs;
+
+    return low ? __builtin_ctzll(low) : 64 + __builtin_ctzll((uint64_t)(discs >> 64));
+#endif
+}
+
+#endif
@@ -0,0 +1,284 @@
+/************************************************************************
+ *
+ *  Proof-number search: proves or disproves that the side to move wins.
+ *
+ *  The search grows a tree of positions best-first. Every node carries a
+ *  proof number, the fewest leaves that would have to be proven to prove the
+ *  win there, and a disproof number, the fewest that would have to be
+ *  disproven, and the search always expands the leaf that most cheaply moves
+ *  the root towards either answer. It only needs a yes or no, so it goes far
+ *  deeper than an exact solve where the answer is clear-cut.
+ *
+ *  Leaves near the end of the game are settled at once by the endgame
+ *  solver. The tree lives in a pool of at most a given number of nodes,
+ *  which bounds the memory, and the search gives up when the pool is full.
+ *
+ ************************************************************************/
+#include "othello.h"
+
+/* leaves with this many empty squares or fewer are settled by the solver */
+#define PROOF_SOLVE_EMPTIES 12
+
+/* proof and disproof numbers of settled nodes */
+#define PROOF_INFINITY 0x3fffffffU
+
+/*
+ * A node of the proof tree. The children of a node are allocated together,
+ * so they are found from the first child and their count. A node where the
+ * side to move is the side proving the win (the attacker) is an OR node, it
+ * needs one proven child; the others are AND nodes and need all of them.
+ */
+typedef struct {
+    Position pos;
+    uint32_t proof;
+    uint32_t disproof;
+    int32_t parent;
+    int32_t first_child;
+    int16_t children;
+    int8_t move;
+    uint8_t attacker;
+} ProofNode;
+
+int init_proof_node(ProofNode *, ProofSearch *);
+int expand_proof_node(ProofNode *, int, ProofSearch *);
+void update_proof_numbers(ProofNode *, int);
+
+/**
+ * Proves or disproves that the side to move wins the given position, that
+ * is ends the game with more discs, within the search's node budget. The
+ * search polls the time check after every expansion and stops once it
+ * answers yes.
+ *
+ * @param pos position to prove, viewed from the side to move
+ * @param search node budget and time check; receives the nodes created and,
+ *               for a proven win, the winning move
+ * @return PROOF_WIN, PROOF_NO_WIN (a draw or a loss) or PROOF_UNKNOWN
+ */
+int prove_win(const Position *pos, ProofSearch *search) {
+    size_t bytes = search->node_budget * sizeof(ProofNode);
+    ProofNode *tree;
+    int outcome = PROOF_UNKNOWN;
+
+    search->nodes = 1;
+    search->move = -1;
+
+    if (search->node_budget < 1 || (tree = allocate_cache(bytes)) == NULL) {
+        return PROOF_UNKNOWN;
+    }
+
+    tree[0].pos = *pos;
+    tree[0].parent = -1;
+    tree[0].attacker = 1;
+    tree[0].move = -1;
+
+    if (!init_proof_node(&tree[0], search)) {
+        free_cache(tree, bytes);
+        return PROOF_UNKNOWN;
+    }
+
+    while (tree[0].proof != 0 && tree[0].disproof != 0) {
+        int node = 0;
+
+        if (search->time_up != NULL && search->time_up()) {
+            break;
+        }
+
+        /* walk down to the most proving leaf: the child that is cheapest to
+           prove below OR nodes and cheapest to disprove below AND nodes */
+        while (tree[node].first_child >= 0) {
+            ProofNode *parent = &tree[node];
+            int best = parent->first_child;
+
+            for (int i = 1; i < parent->children; i++) {
+                ProofNode *child = &tree[parent->first_child + i];
+
+                if (parent->attacker ? child->proof < tree[best].proof : child->disproof < tree[best].disproof) {
+                    best = parent->first_child + i;
+                }
+            }
+
+            node = best;
+        }
+
+        if (!expand_proof_node(tree, node, search)) {
+            break;
+        }
+
+        update_proof_numbers(tree, node);
+    }
+
+    if (tree[0].proof == 0) {
+        outcome = PROOF_WIN;
+
+        for (int i = 0; i < tree[0].children; i++) {
+            if (tree[tree[0].first_child + i].proof == 0) {
+                search->move = tree[tree[0].first_child + i].move;
+                break;
+            }
+        }
+    } else if (tree[0].disproof == 0) {
+        outcome = PROOF_NO_WIN;
+    }
+
+    free_cache(tree, bytes);
+    return outcome;
+}
+
+/**
+ * Sets the proof and disproof numbers of a new leaf. Finished games and
+ * positions the endgame solver can settle quickly are proven or disproven
+ * outright. Other leaves start from the mobility of the side to move: an
+ * attacker with many moves is hard to disprove, and a defender with many
+ * moves is hard to prove.
+ *
+ * @param node leaf to initialise, with its position and side set
+ * @param search time check handed on to the endgame solver
+ * @return 1 if the leaf was initialised, 0 if time ran out in the solver
+ */
+int init_proof_node(ProofNode *node, ProofSearch *search) {
+    Bitboard moves = get_moves(node->pos.player, node->pos.opponent);
+    int empties = BOARD_SQUARES - count_discs(node->pos.player | node->pos.opponent);
+    int win;
+
+    node->first_child = -1;
+    node->children = 0;
+
+    if (moves == 0 && get_moves(node->pos.opponent, node->pos.player) == 0) {
+        int score = count_discs(node->pos.player) - count_discs(node->pos.opponent);
+
+        win = node->attacker ? score > 0 : score < 0;
+    } else if (empties <= PROOF_SOLVE_EMPTIES) {
+        EndgameSearch solve = {0, search->time_up, 0};
+
+        /* null windows on the attacker's side of a draw */
+        if (node->attacker) {
+            win = solve_endgame(&node->pos, 0, 1, &solve) > 0;
+        } else {
+            win = solve_endgame(&node->pos, -1, 0, &solve) < 0;
+        }
+
+        if (solve.stopped) {
+            return 0;
+        }
+    } else {
+        int mobility = (moves != 0) ? count_discs(moves) : 1;
+
+        node->proof = node->attacker ? 1 : (uint32_t)mobility;
+        node->disproof = node->attacker ? (uint32_t)mobility : 1;
+        return 1;
+    }
+
+    node->proof = win ? 0 : PROOF_INFINITY;
+    node->disproof = win ? PROOF_INFINITY : 0;
+    return 1;
+}
+
+/**
+ * Adds the children of a leaf to the tree, one per legal move, or a single
+ * child for a pass. The children most likely to settle the leaf come first,
+ * and none are added after one that does.
+ *
+ * @param tree node pool
+ * @param node index of the leaf to expand
+ * @param search node budget and count
+ * @return 1 if the leaf was expanded, 0 if the pool is full or time ran out
+ */
+int expand_proof_node(ProofNode *tree, int node, ProofSearch *search) {
+    ProofNode *parent = &tree[node];
+    Bitboard moves = get_moves(parent->pos.player, parent->pos.opponent);
+    int count = (moves != 0) ? count_discs(moves) : 1;
+    int first = (int)search->nodes;
+    int replies[MAX_MOVES];
+
+    if ((size_t)first + count > search->node_budget) {
+        return 0;
+    }
+
+    /* children leaving the opponent the fewest replies first, as they are
+       the likeliest to settle the leaf; insertion sort, move lists are short */
+    for (int i = 0; i < count; i++) {
+        int move = (moves != 0) ? first_square(moves) : -1;
+        Position pos = parent->pos;
+        int j = i;
+
+        play_move(&pos, move);
+        int key = count_discs(get_moves(pos.player, pos.opponent));
+
+        while (j > 0 && replies[j - 1] > key) {
+            tree[first + j] = tree[first + j - 1];
+            replies[j] = replies[j - 1];
+            j--;
+        }
+
+        tree[first + j].pos = pos;
+        tree[first + j].move = (int8_t)move;
+        replies[j] = key;
+
+        moves &= moves - 1;
+    }
+
+    for (int i = 0; i < count; i++) {
+        ProofNode *child = &tree[first + i];
+
+        child->parent = node;
+        child->attacker = !parent->attacker;
+
+        if (!init_proof_node(child, search)) {
+            return 0;
+        }
+
+        /* one settled child settles the leaf, so the others are not needed */
+        if (parent->attacker ? child->proof == 0 : child->disproof == 0) {
+            count = i + 1;
+            break;
+        }
+    }
+
+    parent->first_child = first;
+    parent->children = (int16_t)count;
+    search->nodes += count;
+    return 1;
+}
+
+/**
+ * Recomputes the proof and disproof numbers from a newly expanded node up
+ * towards the root, stopping at the first node whose numbers do not change.
+ * An OR node is as easy to prove as its easiest child and as hard to
+ * disprove as all its children together; an AND node the other way round.
+ *
+ * @param tree node pool
+ * @param node index of the expanded node
+ */
+void update_proof_numbers(ProofNode *tree, int node) {
+    while (node >= 0) {
+        ProofNode *parent = &tree[node];
+        uint32_t least = PROOF_INFINITY;
+        uint64_t total = 0;
+
+        for (int i = 0; i < parent->children; i++) {
+            ProofNode *child = &tree[parent->first_child + i];
+            uint32_t easy = parent->attacker ? child->proof : child->disproof;
+            uint32_t hard = parent->attacker ? child->disproof : child->proof;
+
+            if (easy < least) {
+                least = easy;
+            }
+            total += hard;
+        }
+
+        if (total > PROOF_INFINITY) {
+            total = PROOF_INFINITY;
+        }
+
+        uint32_t proof = parent->attacker ? least : (uint32_t)total;
+        uint32_t disproof = parent->attacker ? (uint32_t)total : least;
+
+        if (proof == parent->proof && disproof == parent->disproof && node != 0) {
+            break;
+        }
+
+        parent->proof = proof;
+        parent->disproof = disproof;
+        node = parent->parent;
+    }
+}
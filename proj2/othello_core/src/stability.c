@@ -0,0 +1,171 @@
+/************************************************************************
+ *
+ *  Stable discs: discs that no sequence of moves can flip. The count feeds
+ *  the evaluation, and since stable discs are final it also bounds the
+ *  final disc count in the endgame.
+ *
+ ************************************************************************/
+#include "othello.h"
+
+#if BOARD_SIZE == 8
+#include "stability_tables.h"
+#endif
+
+/* squares where at least one side of every diagonal runs off the board */
+#define BORDER_SQUARES (FIRST_RANK | LAST_RANK | A_FILE | H_FILE)
+
+Bitboard fill_left(Bitboard, Bitboard, int);
+Bitboard fill_right(Bitboard, Bitboard, int);
+Bitboard edge_stable_discs(Bitboard, Bitboard);
+int gather_file(Bitboard);
+Bitboard spread_file(int);
+
+/**
+ * Spreads each of the given discs towards the higher squares along a line,
+ * stopping where the propagator runs out. The shift doubles every step, so a
+ * line of any length is covered in log2(BOARD_SIZE) steps.
+ *
+ * @param discs discs to spread
+ * @param propagator squares the spread may enter from the square before
+ * @param shift square step along the line
+ * @return the discs and every square they spread to
+ */
+Bitboard fill_left(Bitboard discs, Bitboard propagator, int shift) {
+    for (int step = shift; step < BOARD_SIZE * shift; step *= 2) {
+        discs |= propagator & (discs << step);
+        propagator &= propagator << step;
+    }
+
+    return discs;
+}
+
+/**
+ * Spreads each of the given discs towards the lower squares along a line,
+ * as fill_left does towards the higher ones.
+ *
+ * @param discs discs to spread
+ * @param propagator squares the spread may enter from the square after
+ * @param shift square step along the line
+ * @return the discs and every square they spread to
+ */
+Bitboard fill_right(Bitboard discs, Bitboard propagator, int shift) {
+    for (int step = shift; step < BOARD_SIZE * shift; step *= 2) {
+        discs |= propagator & (discs >> step);
+        propagator &= propagator >> step;
+    }
+
+    return discs;
+}
+
+#if BOARD_SIZE == 8
+/**
+ * Gathers the A file into a byte, row r landing on bit r. Each fold moves
+ * the discs of some rows up the file, and only the row's own bit ends up in
+ * the low byte.
+ *
+ * @param discs bitboard to read the A file from
+ * @return the file as a byte
+ */
+int gather_file(Bitboard discs) {
+    discs &= A_FILE;
+    discs |= discs >> 7;
+    discs |= discs >> 14;
+    discs |= discs >> 28;
+
+    return (int)(discs & 0xff);
+}
+
+/**
+ * Spreads a byte back onto the A file, the inverse of gather_file.
+ *
+ * @param line byte with bit r standing for row r
+ * @return bitboard of the A file squares
+ */
+Bitboard spread_file(int line) {
+    Bitboard discs = (Bitboard)line;
+
+    discs |= discs << 7;
+    discs |= discs << 14;
+    discs |= discs << 28;
+
+    return discs & A_FILE;
+}
+
+/**
+ * Returns the player's stable discs on the four edges, looked up from the
+ * edge stability tables.
+ *
+ * @param player bitboard of the player
+ * @param opponent bitboard of the opponent
+ * @return the player's stable edge discs
+ */
+Bitboard edge_stable_discs(Bitboard player, Bitboard opponent) {
+    Bitboard stable;
+
+    stable = EDGE_STABILITY[BASE3[player & 0xff] + 2 * BASE3[opponent & 0xff]];
+    stable |= (Bitboard)EDGE_STABILITY[BASE3[player >> 56] + 2 * BASE3[opponent >> 56]] << 56;
+    stable |= spread_file(EDGE_STABILITY[BASE3[gather_file(player)] + 2 * BASE3[gather_file(opponent)]]);
+    stable |= spread_file(EDGE_STABILITY[BASE3[gather_file(player >> 7)] + 2 * BASE3[gather_file(opponent >> 7)]]) << 7;
+
+    return stable;
+}
+#else
+/**
+ * The edge tables only cover 8x8 boards. On other sizes the edges are left
+ * to the neighbour rule in get_stable_discs, which finds the runs anchored
+ * on corners and full edges.
+ *
+ * @param player bitboard of the player
+ * @param opponent bitboard of the opponent
+ * @return no discs
+ */
+Bitboard edge_stable_discs(Bitboard player, Bitboard opponent) {
+    (void)player;
+    (void)opponent;
+
+    return 0;
+}
+#endif
+
+/**
+ * Returns the player's stable discs. A disc can only be flipped along one of
+ * its four lines, so it is stable when each line is safe: the line is full,
+ * it runs off the board on one side of the disc, or the neighbouring disc on
+ * the line is one of the player's stable discs. The edges are seeded from the
+ * edge tables and the rule is applied until nothing changes.
+ *
+ * The result is a subset of the truly stable discs, never a superset.
+ *
+ * @param player bitboard of the player
+ * @param opponent bitboard of the opponent
+ * @return bitboard of the player's stable discs
+ */
+Bitboard get_stable_discs(Bitboard player, Bitboard opponent) {
+    Bitboard empty = FULL_BOARD & ~(player | opponent);
+    Bitboard stable = edge_stable_discs(player, opponent);
+    Bitboard old;
+
+    /* a line is full when no empty square spreads along it */
+    Bitboard full_h = ~(fill_left(empty, NOT_A_FILE, 1) | fill_right(empty, NOT_H_FILE, 1));
+    Bitboard full_v = ~(fill_left(empty, FULL_BOARD, BOARD_SIZE) | fill_right(empty, FULL_BOARD, BOARD_SIZE));
+    Bitboard full_d9 = ~(fill_left(empty, NOT_A_FILE, BOARD_SIZE + 1) | fill_right(empty, NOT_H_FILE, BOARD_SIZE + 1));
+    Bitboard full_d7 = ~(fill_left(empty, NOT_H_FILE, BOARD_SIZE - 1) | fill_right(empty, NOT_A_FILE, BOARD_SIZE - 1));
+
+    full_h |= A_FILE | H_FILE;
+    full_v |= FIRST_RANK | LAST_RANK;
+    full_d9 |= BORDER_SQUARES;
+    full_d7 |= BORDER_SQUARES;
+
+    stable |= player & full_h & full_v & full_d9 & full_d7;
+
+    do {
+        old = stable;
+        stable |= player &
+                  (full_h | shift_discs(stable, 0) | shift_discs(stable, 4)) &
+                  (full_v | shift_discs(stable, 2) | shift_discs(stable, 6)) &
+                  (full_d9 | shift_discs(stable, 1) | shift_discs(stable, 5)) &
+                  (full_d7 | shift_discs(stable, 3) | shift_discs(stable, 7));
+    } while (stable != old);
+
+    return stable;
+}
@@ -0,0 +1,440 @@
+/* Generated by gen_stability_tables.c, do not edit. */
+#ifndef STABILITY_TABLES_H
+#define STABILITY_TABLES_H
+
+#include <stdint.h>
+
+static const uint16_t BASE3[256] = {
+    0, 1, 3, 4, 9, 10, 12, 13, 27, 28, 30, 31, 36, 37, 39, 40,
+    81, 82, 84, 85, 90, 91, 93, 94, 108, 109, 111, 112, 117, 118, 120, 121,
+    243, 244, 246, 247, 252, 253, 255, 256, 270, 271, 273, 274, 279, 280, 282, 283,
+    324, 325, 327, 328, 333, 334, 336, 337, 351, 352, 354, 355, 360, 361, 363, 364,
+    729, 730, 732, 733, 738, 739, 741, 742, 756, 757, 759, 760, 765, 766, 768, 769,
+    810, 811, 813, 814, 819, 820, 822, 823, 837, 838, 840, 841, 846, 847, 849, 850,
+    972, 973, 975, 976, 981, 982, 984, 985, 999, 1000, 1002, 1003, 1008, 1009, 1011, 1012,
+    1053, 1054, 1056, 1057, 1062, 1063, 1065, 1066, 1080, 1081, 1083, 1084, 1089, 1090, 1092, 1093,
+    2187, 2188, 2190, 2191, 2196, 2197, 2199, 2200, 2214, 2215, 2217, 2218, 2223, 2224, 2226, 2227,
+    2268, 2269, 2271, 2272, 2277, 2278, 2280, 2281, 2295, 2296, 2298, 2299, 2304, 2305, 2307, 2308,
+    2430, 2431, 2433, 2434, 2439, 2440, 2442, 2443, 2457, 2458, 2460, 2461, 2466, 2467, 2469, 2470,
+    2511, 2512, 2514, 2515, 2520, 2521, 2523, 2524, 2538, 2539, 2541, 2542, 2547, 2548, 2550, 2551,
+    2916, 2917, 2919, 2920, 2925, 2926, 2928, 2929, 2943, 2944, 2946, 2947, 2952, 2953, 2955, 2956,
+    2997, 2998, 3000, 3001, 3006, 3007, 3009, 3010, 3024, 3025, 3027, 3028, 3033, 3034, 3036, 3037,
+    3159, 3160, 3162, 3163, 3168, 3169, 3171, 3172, 3186, 3187, 3189, 3190, 3195, 3196, 3198, 3199,
+    3240, 3241, 3243, 3244, 3249, 3250, 3252, 3253, 3267, 3268, 3270, 3271, 3276, 3277, 3279, 3280
+};
+
+static const uint8_t EDGE_STABILITY[6561] = {
+    0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x07, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00,
+    0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x07, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x07, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00,
+    0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x07, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00,
+    0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x01, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x03, 0x02, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x07, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00,
+    0x07, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x01, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x03, 0x02, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x07, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00,
+    0x00, 0x07, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x02, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x07, 0x06, 0x04, 0x05, 0x04, 0x00, 0x01, 0x00, 0x00,
+    0x03, 0x02, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x0f, 0x0e, 0x0c,
+    0x0d, 0x0c, 0x00, 0x09, 0x08, 0x08, 0x0b, 0x0a, 0x08, 0x09, 0x08, 0x00, 0x01, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x07, 0x06, 0x04, 0x05, 0x04, 0x00, 0x01, 0x00,
+    0x00, 0x03, 0x02, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x07, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x0f, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00,
+    0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x07, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x07, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x1f,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x02, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00,
+    0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x07, 0x06, 0x04, 0x05, 0x04, 0x00,
+    0x01, 0x00, 0x00, 0x03, 0x02, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x07, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00,
+    0x0f, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x02, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x07, 0x00, 0x00, 0x01, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x07, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00,
+    0x00, 0x0f, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x07, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x07, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00,
+    0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x1f, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x02, 0x00, 0x01, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x07, 0x06, 0x04,
+    0x05, 0x04, 0x00, 0x01, 0x00, 0x00, 0x03, 0x02, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x07, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00,
+    0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x02, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x07, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00,
+    0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x07, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x02, 0x00,
+    0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00,
+    0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x07, 0x00, 0x00, 0x01, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x02,
+    0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00,
+    0x07, 0x06, 0x04, 0x05, 0x04, 0x00, 0x01, 0x00, 0x00, 0x03, 0x02, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x07, 0x00, 0x00, 0x01, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x0f, 0x0e, 0x0c, 0x0d, 0x0c, 0x00, 0x09, 0x08, 0x08, 0x0b,
+    0x0a, 0x08, 0x09, 0x08, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00,
+    0x00, 0x07, 0x06, 0x04, 0x05, 0x04, 0x00, 0x01, 0x00, 0x00, 0x03, 0x02, 0x00, 0x01, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x07, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00,
+    0x03, 0x02, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x07, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x02, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x1f, 0x1e, 0x1c, 0x1d, 0x1c, 0x00, 0x19, 0x18,
+    0x18, 0x1b, 0x1a, 0x18, 0x19, 0x18, 0x00, 0x01, 0x00, 0x00, 0x13, 0x10, 0x10, 0x11, 0x10, 0x10,
+    0x11, 0x10, 0x10, 0x17, 0x16, 0x14, 0x15, 0x14, 0x00, 0x11, 0x10, 0x10, 0x13, 0x12, 0x10, 0x11,
+    0x10, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x07, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00,
+    0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x0f, 0x0e, 0x0c, 0x0d, 0x0c, 0x00, 0x09,
+    0x08, 0x08, 0x0b, 0x0a, 0x08, 0x09, 0x08, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x07, 0x06, 0x04, 0x05, 0x04, 0x00, 0x01, 0x00, 0x00, 0x03, 0x02, 0x00,
+    0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00,
+    0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x01, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x03, 0x02, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x07, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00,
+    0x07, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x01, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x03, 0x02, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x07, 0x06, 0x04, 0x05, 0x04, 0x00, 0x01, 0x00, 0x00, 0x03,
+    0x02, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00,
+    0x00, 0x07, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x02, 0x00, 0x01, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x0f, 0x0e, 0x0c, 0x0d,
+    0x0c, 0x00, 0x09, 0x08, 0x08, 0x0b, 0x0a, 0x08, 0x09, 0x08, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x07, 0x06, 0x04, 0x05, 0x04, 0x00, 0x01, 0x00, 0x00,
+    0x03, 0x02, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x0f, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x02, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x07, 0x06, 0x04, 0x05, 0x04, 0x00, 0x01, 0x00,
+    0x00, 0x03, 0x02, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x07, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x02, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x3f, 0x3e,
+    0x3c, 0x3d, 0x3c, 0x00, 0x39, 0x38, 0x38, 0x3b, 0x3a, 0x38, 0x39, 0x38, 0x00, 0x01, 0x00, 0x00,
+    0x33, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x37, 0x36, 0x34, 0x35, 0x34, 0x00, 0x31,
+    0x30, 0x30, 0x33, 0x32, 0x30, 0x31, 0x30, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x27, 0x20, 0x20, 0x21, 0x20, 0x00, 0x21, 0x20, 0x00, 0x23, 0x22, 0x20,
+    0x21, 0x20, 0x00, 0x21, 0x20, 0x20, 0x23, 0x20, 0x20, 0x21, 0x20, 0x20, 0x21, 0x20, 0x20, 0x2f,
+    0x2e, 0x2c, 0x2d, 0x2c, 0x20, 0x29, 0x28, 0x28, 0x2b, 0x2a, 0x28, 0x29, 0x28, 0x00, 0x01, 0x00,
+    0x00, 0x23, 0x20, 0x20, 0x21, 0x20, 0x20, 0x21, 0x20, 0x20, 0x27, 0x26, 0x24, 0x25, 0x24, 0x00,
+    0x21, 0x20, 0x20, 0x23, 0x22, 0x20, 0x21, 0x20, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x07, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00,
+    0x0f, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x02, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x07, 0x06, 0x04, 0x05, 0x04,
+    0x00, 0x01, 0x00, 0x00, 0x03, 0x02, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x07, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03,
+    0x02, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00,
+    0x00, 0x1f, 0x1e, 0x1c, 0x1d, 0x1c, 0x00, 0x19, 0x18, 0x18, 0x1b, 0x1a, 0x18, 0x19, 0x18, 0x00,
+    0x01, 0x00, 0x00, 0x13, 0x10, 0x10, 0x11, 0x10, 0x10, 0x11, 0x10, 0x10, 0x17, 0x16, 0x14, 0x15,
+    0x14, 0x00, 0x11, 0x10, 0x10, 0x13, 0x12, 0x10, 0x11, 0x10, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x07, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00,
+    0x03, 0x02, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x0f, 0x0e, 0x0c, 0x0d, 0x0c, 0x00, 0x09, 0x08, 0x08, 0x0b, 0x0a, 0x08, 0x09, 0x08,
+    0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x07, 0x06, 0x04,
+    0x05, 0x04, 0x00, 0x01, 0x00, 0x00, 0x03, 0x02, 0x00, 0x01, 0x00, 0x80, 0x81, 0x80, 0x80, 0x83,
+    0x80, 0x80, 0x81, 0x80, 0x80, 0x81, 0x80, 0x80, 0x87, 0x80, 0x80, 0x81, 0x80, 0x80, 0x81, 0x80,
+    0x80, 0x83, 0x80, 0x80, 0x81, 0x80, 0x80, 0x81, 0x80, 0x80, 0x83, 0x80, 0x80, 0x81, 0x80, 0x80,
+    0x81, 0x80, 0x80, 0x8f, 0x80, 0x80, 0x81, 0x80, 0x80, 0x81, 0x80, 0x80, 0x83, 0x80, 0x80, 0x81,
+    0x80, 0x80, 0x81, 0x80, 0x80, 0x83, 0x80, 0x80, 0x81, 0x80, 0x80, 0x81, 0x80, 0x80, 0x87, 0x80,
+    0x80, 0x81, 0x80, 0x80, 0x81, 0x80, 0x80, 0x83, 0x80, 0x80, 0x81, 0x80, 0x80, 0x81, 0x80, 0x80,
+    0x83, 0x80, 0x80, 0x81, 0x80, 0x80, 0x81, 0x80, 0x80, 0x87, 0x80, 0x80, 0x81, 0x80, 0x80, 0x81,
+    0x80, 0x80, 0x83, 0x80, 0x80, 0x81, 0x80, 0x80, 0x81, 0x80, 0x80, 0x83, 0x80, 0x80, 0x81, 0x80,
+    0x80, 0x81, 0x80, 0x80, 0x9f, 0x80, 0x80, 0x81, 0x80, 0x80, 0x81, 0x80, 0x80, 0x83, 0x82, 0x80,
+    0x81, 0x80, 0x80, 0x81, 0x80, 0x80, 0x83, 0x80, 0x80, 0x81, 0x80, 0x80, 0x81, 0x80, 0x80, 0x87,
+    0x86, 0x84, 0x85, 0x84, 0x80, 0x81, 0x80, 0x80, 0x83, 0x82, 0x80, 0x81, 0x80, 0x80, 0x81, 0x80,
+    0x80, 0x83, 0x80, 0x80, 0x81, 0x80, 0x80, 0x81, 0x80, 0x80, 0x87, 0x80, 0x80, 0x81, 0x80, 0x80,
+    0x81, 0x80, 0x80, 0x83, 0x80, 0x80, 0x81, 0x80, 0x80, 0x81, 0x80, 0x80, 0x83, 0x80, 0x80, 0x81,
+    0x80, 0x80, 0x81, 0x80, 0x80, 0x8f, 0x80, 0x80, 0x81, 0x80, 0x80, 0x81, 0x80, 0x80, 0x83, 0x82,
+    0x80, 0x81, 0x80, 0x80, 0x81, 0x80, 0x80, 0x83, 0x80, 0x80, 0x81, 0x80, 0x80, 0x81, 0x80, 0x80,
+    0x87, 0x80, 0x80, 0x81, 0x80, 0x80, 0x81, 0x80, 0x80, 0x83, 0x80, 0x80, 0x81, 0x80, 0x80, 0x81,
+    0x80, 0x80, 0x83, 0x80, 0x80, 0x81, 0x80, 0x80, 0x81, 0x80, 0x80, 0x87, 0x80, 0x80, 0x81, 0x80,
+    0x80, 0x81, 0x80, 0x80, 0x83, 0x80, 0x80, 0x81, 0x80, 0x80, 0x81, 0x80, 0x80, 0x83, 0x80, 0x80,
+    0x81, 0x80, 0x80, 0x81, 0x80, 0x80, 0x8f, 0x80, 0x80, 0x81, 0x80, 0x80, 0x81, 0x80, 0x80, 0x83,
+    0x82, 0x80, 0x81, 0x80, 0x80, 0x81, 0x80, 0x80, 0x83, 0x80, 0x80, 0x81, 0x80, 0x80, 0x81, 0x80,
+    0x80, 0x87, 0x80, 0x80, 0x81, 0x80, 0x80, 0x81, 0x80, 0x80, 0x83, 0x80, 0x80, 0x81, 0x80, 0x80,
+    0x81, 0x80, 0x80, 0x83, 0x80, 0x80, 0x81, 0x80, 0x80, 0x81, 0x80, 0x80, 0x87, 0x80, 0x80, 0x81,
+    0x80, 0x80, 0x81, 0x80, 0x80, 0x83, 0x80, 0x80, 0x81, 0x80, 0x80, 0x81, 0x80, 0x80, 0x83, 0x80,
+    0x80, 0x81, 0x80, 0x80, 0x81, 0x80, 0x80, 0xbf, 0x80, 0x80, 0x81, 0x80, 0x80, 0x81, 0x80, 0x80,
+    0x83, 0x82, 0x80, 0x81, 0x80, 0x80, 0x81, 0x80, 0x80, 0x83, 0x80, 0x80, 0x81, 0x80, 0x80, 0x81,
+    0x80, 0x80, 0x87, 0x86, 0x84, 0x85, 0x84, 0x80, 0x81, 0x80, 0x80, 0x83, 0x82, 0x80, 0x81, 0x80,
+    0x80, 0x81, 0x80, 0x80, 0x83, 0x80, 0x80, 0x81, 0x80, 0x80, 0x81, 0x80, 0x80, 0x87, 0x80, 0x80,
+    0x81, 0x80, 0x80, 0x81, 0x80, 0x80, 0x83, 0x80, 0x80, 0x81, 0x80, 0x80, 0x81, 0x80, 0x80, 0x83,
+    0x80, 0x80, 0x81, 0x80, 0x80, 0x81, 0x80, 0x80, 0x8f, 0x8e, 0x8c, 0x8d, 0x8c, 0x80, 0x89, 0x88,
+    0x88, 0x8b, 0x8a, 0x88, 0x89, 0x88, 0x80, 0x81, 0x80, 0x80, 0x83, 0x80, 0x80, 0x81, 0x80, 0x80,
+    0x81, 0x80, 0x80, 0x87, 0x86, 0x84, 0x85, 0x84, 0x80, 0x81, 0x80, 0x80, 0x83, 0x82, 0x80, 0x81,
+    0x80, 0x80, 0x81, 0x80, 0x80, 0x83, 0x80, 0x80, 0x81, 0x80, 0x80, 0x81, 0x80, 0x80, 0x87, 0x80,
+    0x80, 0x81, 0x80, 0x80, 0x81, 0x80, 0x80, 0x83, 0x80, 0x80, 0x81, 0x80, 0x80, 0x81, 0x80, 0x80,
+    0x83, 0x80, 0x80, 0x81, 0x80, 0x80, 0x81, 0x80, 0x80, 0x8f, 0x80, 0x80, 0x81, 0x80, 0x80, 0x81,
+    0x80, 0x80, 0x83, 0x82, 0x80, 0x81, 0x80, 0x80, 0x81, 0x80, 0x80, 0x83, 0x80, 0x80, 0x81, 0x80,
+    0x80, 0x81, 0x80, 0x80, 0x87, 0x86, 0x84, 0x85, 0x84, 0x80, 0x81, 0x80, 0x80, 0x83, 0x82, 0x80,
+    0x81, 0x80, 0x80, 0x81, 0x80, 0x80, 0x83, 0x80, 0x80, 0x81, 0x80, 0x80, 0x81, 0x80, 0x80, 0x87,
+    0x80, 0x80, 0x81, 0x80, 0x80, 0x81, 0x80, 0x80, 0x83, 0x82, 0x80, 0x81, 0x80, 0x80, 0x81, 0x80,
+    0x80, 0x83, 0x80, 0x80, 0x81, 0x80, 0x80, 0x81, 0x80, 0x80, 0x9f, 0x9e, 0x9c, 0x9d, 0x9c, 0x80,
+    0x99, 0x98, 0x98, 0x9b, 0x9a, 0x98, 0x99, 0x98, 0x80, 0x81, 0x80, 0x80, 0x93, 0x90, 0x90, 0x91,
+    0x90, 0x90, 0x91, 0x90, 0x90, 0x97, 0x96, 0x94, 0x95, 0x94, 0x80, 0x91, 0x90, 0x90, 0x93, 0x92,
+    0x90, 0x91, 0x90, 0x80, 0x81, 0x80, 0x80, 0x83, 0x80, 0x80, 0x81, 0x80, 0x80, 0x81, 0x80, 0x80,
+    0x87, 0x80, 0x80, 0x81, 0x80, 0x80, 0x81, 0x80, 0x80, 0x83, 0x82, 0x80, 0x81, 0x80, 0x80, 0x81,
+    0x80, 0x80, 0x83, 0x80, 0x80, 0x81, 0x80, 0x80, 0x81, 0x80, 0x80, 0x8f, 0x8e, 0x8c, 0x8d, 0x8c,
+    0x80, 0x89, 0x88, 0x88, 0x8b, 0x8a, 0x88, 0x89, 0x88, 0x80, 0x81, 0x80, 0x80, 0x83, 0x80, 0x80,
+    0x81, 0x80, 0x80, 0x81, 0x80, 0x80, 0x87, 0x86, 0x84, 0x85, 0x84, 0x80, 0x81, 0x80, 0x80, 0x83,
+    0x82, 0x80, 0x81, 0x80, 0xc0, 0xc1, 0xc0, 0xc0, 0xc3, 0xc0, 0xc0, 0xc1, 0xc0, 0xc0, 0xc1, 0xc0,
+    0xc0, 0xc7, 0xc0, 0xc0, 0xc1, 0xc0, 0xc0, 0xc1, 0xc0, 0xc0, 0xc3, 0xc0, 0xc0, 0xc1, 0xc0, 0xc0,
+    0xc1, 0xc0, 0xc0, 0xc3, 0xc0, 0xc0, 0xc1, 0xc0, 0xc0, 0xc1, 0xc0, 0xc0, 0xcf, 0xc0, 0xc0, 0xc1,
+    0xc0, 0xc0, 0xc1, 0xc0, 0xc0, 0xc3, 0xc2, 0xc0, 0xc1, 0xc0, 0xc0, 0xc1, 0xc0, 0xc0, 0xc3, 0xc0,
+    0xc0, 0xc1, 0xc0, 0xc0, 0xc1, 0xc0, 0xc0, 0xc7, 0xc0, 0xc0, 0xc1, 0xc0, 0xc0, 0xc1, 0xc0, 0xc0,
+    0xc3, 0xc0, 0xc0, 0xc1, 0xc0, 0xc0, 0xc1, 0xc0, 0xc0, 0xc3, 0xc0, 0xc0, 0xc1, 0xc0, 0xc0, 0xc1,
+    0xc0, 0xc0, 0xc7, 0xc0, 0xc0, 0xc1, 0xc0, 0xc0, 0xc1, 0xc0, 0xc0, 0xc3, 0xc0, 0xc0, 0xc1, 0xc0,
+    0xc0, 0xc1, 0xc0, 0xc0, 0xc3, 0xc0, 0xc0, 0xc1, 0xc0, 0xc0, 0xc1, 0xc0, 0xc0, 0xdf, 0xc0, 0xc0,
+    0xc1, 0xc0, 0xc0, 0xc1, 0xc0, 0xc0, 0xc3, 0xc2, 0xc0, 0xc1, 0xc0, 0xc0, 0xc1, 0xc0, 0xc0, 0xc3,
+    0xc0, 0xc0, 0xc1, 0xc0, 0xc0, 0xc1, 0xc0, 0xc0, 0xc7, 0xc6, 0xc4, 0xc5, 0xc4, 0xc0, 0xc1, 0xc0,
+    0xc0, 0xc3, 0xc2, 0xc0, 0xc1, 0xc0, 0xc0, 0xc1, 0xc0, 0xc0, 0xc3, 0xc0, 0xc0, 0xc1, 0xc0, 0xc0,
+    0xc1, 0xc0, 0xc0, 0xc7, 0xc0, 0xc0, 0xc1, 0xc0, 0xc0, 0xc1, 0xc0, 0xc0, 0xc3, 0xc2, 0xc0, 0xc1,
+    0xc0, 0xc0, 0xc1, 0xc0, 0xc0, 0xc3, 0xc0, 0xc0, 0xc1, 0xc0, 0xc0, 0xc1, 0xc0, 0xc0, 0xcf, 0xce,
+    0xcc, 0xcd, 0xcc, 0xc0, 0xc9, 0xc8, 0xc8, 0xcb, 0xca, 0xc8, 0xc9, 0xc8, 0xc0, 0xc1, 0xc0, 0xc0,
+    0xc3, 0xc0, 0xc0, 0xc1, 0xc0, 0xc0, 0xc1, 0xc0, 0xc0, 0xc7, 0xc6, 0xc4, 0xc5, 0xc4, 0xc0, 0xc1,
+    0xc0, 0xc0, 0xc3, 0xc2, 0xc0, 0xc1, 0xc0, 0xe0, 0xe1, 0xe0, 0xe0, 0xe3, 0xe0, 0xe0, 0xe1, 0xe0,
+    0xe0, 0xe1, 0xe0, 0xe0, 0xe7, 0xe0, 0xe0, 0xe1, 0xe0, 0xe0, 0xe1, 0xe0, 0xe0, 0xe3, 0xe0, 0xe0,
+    0xe1, 0xe0, 0xe0, 0xe1, 0xe0, 0xe0, 0xe3, 0xe0, 0xe0, 0xe1, 0xe0, 0xe0, 0xe1, 0xe0, 0xe0, 0xef,
+    0xe0, 0xe0, 0xe1, 0xe0, 0xe0, 0xe1, 0xe0, 0xe0, 0xe3, 0xe2, 0xe0, 0xe1, 0xe0, 0xe0, 0xe1, 0xe0,
+    0xe0, 0xe3, 0xe0, 0xe0, 0xe1, 0xe0, 0xe0, 0xe1, 0xe0, 0xe0, 0xe7, 0xe6, 0xe4, 0xe5, 0xe4, 0xe0,
+    0xe1, 0xe0, 0xe0, 0xe3, 0xe2, 0xe0, 0xe1, 0xe0, 0xf0, 0xf1, 0xf0, 0xf0, 0xf3, 0xf0, 0xf0, 0xf1,
+    0xf0, 0xf0, 0xf1, 0xf0, 0xf0, 0xf7, 0xf0, 0xf0, 0xf1, 0xf0, 0xf0, 0xf1, 0xf0, 0xf0, 0xf3, 0xf2,
+    0xf0, 0xf1, 0xf0, 0xf8, 0xf9, 0xf8, 0xf8, 0xfb, 0xf8, 0xf8, 0xf9, 0xf8, 0xfc, 0xfd, 0xfc, 0xfe,
+    0xff, 0xfe, 0xfc, 0xfd, 0xfc, 0xf8, 0xf9, 0xf8, 0xf8, 0xfb, 0xfa, 0xf8, 0xf9, 0xf8, 0xf0, 0xf1,
+    0xf0, 0xf0, 0xf3, 0xf0, 0xf0, 0xf1, 0xf0, 0xf0, 0xf1, 0xf0, 0xf0, 0xf7, 0xf6, 0xf4, 0xf5, 0xf4,
+    0xf0, 0xf1, 0xf0, 0xf0, 0xf3, 0xf2, 0xf0, 0xf1, 0xf0, 0xe0, 0xe1, 0xe0, 0xe0, 0xe3, 0xe0, 0xe0,
+    0xe1, 0xe0, 0xe0, 0xe1, 0xe0, 0xe0, 0xe7, 0xe0, 0xe0, 0xe1, 0xe0, 0xe0, 0xe1, 0xe0, 0xe0, 0xe3,
+    0xe2, 0xe0, 0xe1, 0xe0, 0xe0, 0xe1, 0xe0, 0xe0, 0xe3, 0xe0, 0xe0, 0xe1, 0xe0, 0xe0, 0xe1, 0xe0,
+    0xe0, 0xef, 0xee, 0xec, 0xed, 0xec, 0xe0, 0xe9, 0xe8, 0xe8, 0xeb, 0xea, 0xe8, 0xe9, 0xe8, 0xe0,
+    0xe1, 0xe0, 0xe0, 0xe3, 0xe0, 0xe0, 0xe1, 0xe0, 0xe0, 0xe1, 0xe0, 0xe0, 0xe7, 0xe6, 0xe4, 0xe5,
+    0xe4, 0xe0, 0xe1, 0xe0, 0xe0, 0xe3, 0xe2, 0xe0, 0xe1, 0xe0, 0xc0, 0xc1, 0xc0, 0xc0, 0xc3, 0xc0,
+    0xc0, 0xc1, 0xc0, 0xc0, 0xc1, 0xc0, 0xc0, 0xc7, 0xc0, 0xc0, 0xc1, 0xc0, 0xc0, 0xc1, 0xc0, 0xc0,
+    0xc3, 0xc0, 0xc0, 0xc1, 0xc0, 0xc0, 0xc1, 0xc0, 0xc0, 0xc3, 0xc0, 0xc0, 0xc1, 0xc0, 0xc0, 0xc1,
+    0xc0, 0xc0, 0xcf, 0xc0, 0xc0, 0xc1, 0xc0, 0xc0, 0xc1, 0xc0, 0xc0, 0xc3, 0xc2, 0xc0, 0xc1, 0xc0,
+    0xc0, 0xc1, 0xc0, 0xc0, 0xc3, 0xc0, 0xc0, 0xc1, 0xc0, 0xc0, 0xc1, 0xc0, 0xc0, 0xc7, 0xc6, 0xc4,
+    0xc5, 0xc4, 0xc0, 0xc1, 0xc0, 0xc0, 0xc3, 0xc2, 0xc0, 0xc1, 0xc0, 0xc0, 0xc1, 0xc0, 0xc0, 0xc3,
+    0xc0, 0xc0, 0xc1, 0xc0, 0xc0, 0xc1, 0xc0, 0xc0, 0xc7, 0xc0, 0xc0, 0xc1, 0xc0, 0xc0, 0xc1, 0xc0,
+    0xc0, 0xc3, 0xc2, 0xc0, 0xc1, 0xc0, 0xc0, 0xc1, 0xc0, 0xc0, 0xc3, 0xc0, 0xc0, 0xc1, 0xc0, 0xc0,
+    0xc1, 0xc0, 0xc0, 0xdf, 0xde, 0xdc, 0xdd, 0xdc, 0xc0, 0xd9, 0xd8, 0xd8, 0xdb, 0xda, 0xd8, 0xd9,
+    0xd8, 0xc0, 0xc1, 0xc0, 0xc0, 0xd3, 0xd0, 0xd0, 0xd1, 0xd0, 0xd0, 0xd1, 0xd0, 0xd0, 0xd7, 0xd6,
+    0xd4, 0xd5, 0xd4, 0xc0, 0xd1, 0xd0, 0xd0, 0xd3, 0xd2, 0xd0, 0xd1, 0xd0, 0xc0, 0xc1, 0xc0, 0xc0,
+    0xc3, 0xc0, 0xc0, 0xc1, 0xc0, 0xc0, 0xc1, 0xc0, 0xc0, 0xc7, 0xc0, 0xc0, 0xc1, 0xc0, 0xc0, 0xc1,
+    0xc0, 0xc0, 0xc3, 0xc2, 0xc0, 0xc1, 0xc0, 0xc0, 0xc1, 0xc0, 0xc0, 0xc3, 0xc0, 0xc0, 0xc1, 0xc0,
+    0xc0, 0xc1, 0xc0, 0xc0, 0xcf, 0xce, 0xcc, 0xcd, 0xcc, 0xc0, 0xc9, 0xc8, 0xc8, 0xcb, 0xca, 0xc8,
+    0xc9, 0xc8, 0xc0, 0xc1, 0xc0, 0xc0, 0xc3, 0xc0, 0xc0, 0xc1, 0xc0, 0xc0, 0xc1, 0xc0, 0xc0, 0xc7,
+    0xc6, 0xc4, 0xc5, 0xc4, 0xc0, 0xc1, 0xc0, 0xc0, 0xc3, 0xc2, 0xc0, 0xc1, 0xc0, 0x80, 0x81, 0x80,
+    0x80, 0x83, 0x80, 0x80, 0x81, 0x80, 0x80, 0x81, 0x80, 0x80, 0x87, 0x80, 0x80, 0x81, 0x80, 0x80,
+    0x81, 0x80, 0x80, 0x83, 0x80, 0x80, 0x81, 0x80, 0x80, 0x81, 0x80, 0x80, 0x83, 0x80, 0x80, 0x81,
+    0x80, 0x80, 0x81, 0x80, 0x80, 0x8f, 0x80, 0x80, 0x81, 0x80, 0x80, 0x81, 0x80, 0x80, 0x83, 0x82,
+    0x80, 0x81, 0x80, 0x80, 0x81, 0x80, 0x80, 0x83, 0x80, 0x80, 0x81, 0x80, 0x80, 0x81, 0x80, 0x80,
+    0x87, 0x80, 0x80, 0x81, 0x80, 0x80, 0x81, 0x80, 0x80, 0x83, 0x80, 0x80, 0x81, 0x80, 0x80, 0x81,
+    0x80, 0x80, 0x83, 0x80, 0x80, 0x81, 0x80, 0x80, 0x81, 0x80, 0x80, 0x87, 0x80, 0x80, 0x81, 0x80,
+    0x80, 0x81, 0x80, 0x80, 0x83, 0x80, 0x80, 0x81, 0x80, 0x80, 0x81, 0x80, 0x80, 0x83, 0x80, 0x80,
+    0x81, 0x80, 0x80, 0x81, 0x80, 0x80, 0x9f, 0x80, 0x80, 0x81, 0x80, 0x80, 0x81, 0x80, 0x80, 0x83,
+    0x82, 0x80, 0x81, 0x80, 0x80, 0x81, 0x80, 0x80, 0x83, 0x80, 0x80, 0x81, 0x80, 0x80, 0x81, 0x80,
+    0x80, 0x87, 0x86, 0x84, 0x85, 0x84, 0x80, 0x81, 0x80, 0x80, 0x83, 0x82, 0x80, 0x81, 0x80, 0x80,
+    0x81, 0x80, 0x80, 0x83, 0x80, 0x80, 0x81, 0x80, 0x80, 0x81, 0x80, 0x80, 0x87, 0x80, 0x80, 0x81,
+    0x80, 0x80, 0x81, 0x80, 0x80, 0x83, 0x82, 0x80, 0x81, 0x80, 0x80, 0x81, 0x80, 0x80, 0x83, 0x80,
+    0x80, 0x81, 0x80, 0x80, 0x81, 0x80, 0x80, 0x8f, 0x8e, 0x8c, 0x8d, 0x8c, 0x80, 0x89, 0x88, 0x88,
+    0x8b, 0x8a, 0x88, 0x89, 0x88, 0x80, 0x81, 0x80, 0x80, 0x83, 0x80, 0x80, 0x81, 0x80, 0x80, 0x81,
+    0x80, 0x80, 0x87, 0x86, 0x84, 0x85, 0x84, 0x80, 0x81, 0x80, 0x80, 0x83, 0x82, 0x80, 0x81, 0x80,
+    0x80, 0x81, 0x80, 0x80, 0x83, 0x80, 0x80, 0x81, 0x80, 0x80, 0x81, 0x80, 0x80, 0x87, 0x80, 0x80,
+    0x81, 0x80, 0x80, 0x81, 0x80, 0x80, 0x83, 0x80, 0x80, 0x81, 0x80, 0x80, 0x81, 0x80, 0x80, 0x83,
+    0x80, 0x80, 0x81, 0x80, 0x80, 0x81, 0x80, 0x80, 0x8f, 0x80, 0x80, 0x81, 0x80, 0x80, 0x81, 0x80,
+    0x80, 0x83, 0x82, 0x80, 0x81, 0x80, 0x80, 0x81, 0x80, 0x80, 0x83, 0x80, 0x80, 0x81, 0x80, 0x80,
+    0x81, 0x80, 0x80, 0x87, 0x86, 0x84, 0x85, 0x84, 0x80, 0x81, 0x80, 0x80, 0x83, 0x82, 0x80, 0x81,
+    0x80, 0x80, 0x81, 0x80, 0x80, 0x83, 0x80, 0x80, 0x81, 0x80, 0x80, 0x81, 0x80, 0x80, 0x87, 0x80,
+    0x80, 0x81, 0x80, 0x80, 0x81, 0x80, 0x80, 0x83, 0x82, 0x80, 0x81, 0x80, 0x80, 0x81, 0x80, 0x80,
+    0x83, 0x80, 0x80, 0x81, 0x80, 0x80, 0x81, 0x80, 0x80, 0xbf, 0xbe, 0xbc, 0xbd, 0xbc, 0x80, 0xb9,
+    0xb8, 0xb8, 0xbb, 0xba, 0xb8, 0xb9, 0xb8, 0x80, 0x81, 0x80, 0x80, 0xb3, 0xb0, 0xb0, 0xb1, 0xb0,
+    0xb0, 0xb1, 0xb0, 0xb0, 0xb7, 0xb6, 0xb4, 0xb5, 0xb4, 0x80, 0xb1, 0xb0, 0xb0, 0xb3, 0xb2, 0xb0,
+    0xb1, 0xb0, 0x80, 0x81, 0x80, 0x80, 0x83, 0x80, 0x80, 0x81, 0x80, 0x80, 0x81, 0x80, 0x80, 0xa7,
+    0xa0, 0xa0, 0xa1, 0xa0, 0x80, 0xa1, 0xa0, 0x80, 0xa3, 0xa2, 0xa0, 0xa1, 0xa0, 0x80, 0xa1, 0xa0,
+    0xa0, 0xa3, 0xa0, 0xa0, 0xa1, 0xa0, 0xa0, 0xa1, 0xa0, 0xa0, 0xaf, 0xae, 0xac, 0xad, 0xac, 0xa0,
+    0xa9, 0xa8, 0xa8, 0xab, 0xaa, 0xa8, 0xa9, 0xa8, 0x80, 0x81, 0x80, 0x80, 0xa3, 0xa0, 0xa0, 0xa1,
+    0xa0, 0xa0, 0xa1, 0xa0, 0xa0, 0xa7, 0xa6, 0xa4, 0xa5, 0xa4, 0x80, 0xa1, 0xa0, 0xa0, 0xa3, 0xa2,
+    0xa0, 0xa1, 0xa0, 0x80, 0x81, 0x80, 0x80, 0x83, 0x80, 0x80, 0x81, 0x80, 0x80, 0x81, 0x80, 0x80,
+    0x87, 0x80, 0x80, 0x81, 0x80, 0x80, 0x81, 0x80, 0x80, 0x83, 0x80, 0x80, 0x81, 0x80, 0x80, 0x81,
+    0x80, 0x80, 0x83, 0x80, 0x80, 0x81, 0x80, 0x80, 0x81, 0x80, 0x80, 0x8f, 0x80, 0x80, 0x81, 0x80,
+    0x80, 0x81, 0x80, 0x80, 0x83, 0x82, 0x80, 0x81, 0x80, 0x80, 0x81, 0x80, 0x80, 0x83, 0x80, 0x80,
+    0x81, 0x80, 0x80, 0x81, 0x80, 0x80, 0x87, 0x86, 0x84, 0x85, 0x84, 0x80, 0x81, 0x80, 0x80, 0x83,
+    0x82, 0x80, 0x81, 0x80, 0x80, 0x81, 0x80, 0x80, 0x83, 0x80, 0x80, 0x81, 0x80, 0x80, 0x81, 0x80,
+    0x80, 0x87, 0x80, 0x80, 0x81, 0x80, 0x80, 0x81, 0x80, 0x80, 0x83, 0x82, 0x80, 0x81, 0x80, 0x80,
+    0x81, 0x80, 0x80, 0x83, 0x80, 0x80, 0x81, 0x80, 0x80, 0x81, 0x80, 0x80, 0x9f, 0x9e, 0x9c, 0x9d,
+    0x9c, 0x80, 0x99, 0x98, 0x98, 0x9b, 0x9a, 0x98, 0x99, 0x98, 0x80, 0x81, 0x80, 0x80, 0x93, 0x90,
+    0x90, 0x91, 0x90, 0x90, 0x91, 0x90, 0x90, 0x97, 0x96, 0x94, 0x95, 0x94, 0x80, 0x91, 0x90, 0x90,
+    0x93, 0x92, 0x90, 0x91, 0x90, 0x80, 0x81, 0x80, 0x80, 0x83, 0x80, 0x80, 0x81, 0x80, 0x80, 0x81,
+    0x80, 0x80, 0x87, 0x80, 0x80, 0x81, 0x80, 0x80, 0x81, 0x80, 0x80, 0x83, 0x82, 0x80, 0x81, 0x80,
+    0x80, 0x81, 0x80, 0x80, 0x83, 0x80, 0x80, 0x81, 0x80, 0x80, 0x81, 0x80, 0x80, 0x8f, 0x8e, 0x8c,
+    0x8d, 0x8c, 0x80, 0x89, 0x88, 0x88, 0x8b, 0x8a, 0x88, 0x89, 0x88, 0x80, 0x81, 0x80, 0x80, 0x83,
+    0x80, 0x80, 0x81, 0x80, 0x80, 0x81, 0x80, 0x80, 0x87, 0x86, 0x84, 0x85, 0x84, 0x80, 0x81, 0x80,
+    0x80, 0x83, 0x82, 0x80, 0x81, 0x80, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x07, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x0f, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00,
+    0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x07, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x07, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x1f,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x02, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00,
+    0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x07, 0x06, 0x04, 0x05, 0x04, 0x00,
+    0x01, 0x00, 0x00, 0x03, 0x02, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x07, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00,
+    0x0f, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x02, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x07, 0x00, 0x00, 0x01, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x07, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00,
+    0x00, 0x0f, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x02, 0x00, 0x01, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x07, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x07, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00,
+    0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x3f, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x02, 0x00, 0x01, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x07, 0x06, 0x04,
+    0x05, 0x04, 0x00, 0x01, 0x00, 0x00, 0x03, 0x02, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x07, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00,
+    0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x0f, 0x0e, 0x0c, 0x0d, 0x0c, 0x00, 0x09, 0x08, 0x08, 0x0b, 0x0a, 0x08, 0x09,
+    0x08, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x07, 0x06,
+    0x04, 0x05, 0x04, 0x00, 0x01, 0x00, 0x00, 0x03, 0x02, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00,
+    0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x07, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x02, 0x00,
+    0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x07,
+    0x06, 0x04, 0x05, 0x04, 0x00, 0x01, 0x00, 0x00, 0x03, 0x02, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00,
+    0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x07, 0x00, 0x00, 0x01, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x03, 0x02, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x1f, 0x1e, 0x1c, 0x1d, 0x1c, 0x00, 0x19, 0x18, 0x18, 0x1b, 0x1a,
+    0x18, 0x19, 0x18, 0x00, 0x01, 0x00, 0x00, 0x13, 0x10, 0x10, 0x11, 0x10, 0x10, 0x11, 0x10, 0x10,
+    0x17, 0x16, 0x14, 0x15, 0x14, 0x00, 0x11, 0x10, 0x10, 0x13, 0x12, 0x10, 0x11, 0x10, 0x00, 0x01,
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x07, 0x00, 0x00, 0x01, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x03, 0x02, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x0f, 0x0e, 0x0c, 0x0d, 0x0c, 0x00, 0x09, 0x08, 0x08, 0x0b,
+    0x0a, 0x08, 0x09, 0x08, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00,
+    0x00, 0x07, 0x06, 0x04, 0x05, 0x04, 0x00, 0x01, 0x00, 0x00, 0x03, 0x02, 0x00, 0x01, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x07, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00,
+    0x03, 0x02, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x07, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00,
+    0x00, 0x03, 0x02, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x07, 0x06, 0x04, 0x05, 0x04, 0x00, 0x01, 0x00, 0x00, 0x03, 0x02, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x07, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x02, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00,
+    0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x0f, 0x0e, 0x0c, 0x0d, 0x0c, 0x00, 0x09,
+    0x08, 0x08, 0x0b, 0x0a, 0x08, 0x09, 0x08, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x07, 0x06, 0x04, 0x05, 0x04, 0x00, 0x01, 0x00, 0x00, 0x03, 0x02, 0x00,
+    0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00,
+    0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x01, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x03, 0x02, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x07, 0x06, 0x04, 0x05, 0x04, 0x00, 0x01, 0x00, 0x00, 0x03, 0x02,
+    0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00,
+    0x07, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x02, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x7f, 0x7e, 0x7c, 0x7d, 0x7c,
+    0x00, 0x79, 0x78, 0x78, 0x7b, 0x7a, 0x78, 0x79, 0x78, 0x00, 0x01, 0x00, 0x00, 0x73, 0x70, 0x70,
+    0x71, 0x70, 0x70, 0x71, 0x70, 0x70, 0x77, 0x76, 0x74, 0x75, 0x74, 0x00, 0x71, 0x70, 0x70, 0x73,
+    0x72, 0x70, 0x71, 0x70, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00,
+    0x00, 0x67, 0x60, 0x60, 0x61, 0x60, 0x00, 0x61, 0x60, 0x00, 0x63, 0x62, 0x60, 0x61, 0x60, 0x00,
+    0x61, 0x60, 0x60, 0x63, 0x60, 0x60, 0x61, 0x60, 0x60, 0x61, 0x60, 0x60, 0x6f, 0x6e, 0x6c, 0x6d,
+    0x6c, 0x60, 0x69, 0x68, 0x68, 0x6b, 0x6a, 0x68, 0x69, 0x68, 0x00, 0x01, 0x00, 0x00, 0x63, 0x60,
+    0x60, 0x61, 0x60, 0x60, 0x61, 0x60, 0x60, 0x67, 0x66, 0x64, 0x65, 0x64, 0x00, 0x61, 0x60, 0x60,
+    0x63, 0x62, 0x60, 0x61, 0x60, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x4f, 0x40, 0x40,
+    0x41, 0x40, 0x00, 0x41, 0x40, 0x40, 0x43, 0x42, 0x40, 0x41, 0x40, 0x00, 0x01, 0x00, 0x00, 0x43,
+    0x40, 0x40, 0x41, 0x40, 0x00, 0x01, 0x00, 0x00, 0x47, 0x46, 0x44, 0x45, 0x44, 0x00, 0x41, 0x40,
+    0x00, 0x43, 0x42, 0x40, 0x41, 0x40, 0x00, 0x01, 0x00, 0x00, 0x43, 0x40, 0x40, 0x41, 0x40, 0x40,
+    0x41, 0x40, 0x40, 0x47, 0x40, 0x40, 0x41, 0x40, 0x00, 0x41, 0x40, 0x40, 0x43, 0x42, 0x40, 0x41,
+    0x40, 0x00, 0x41, 0x40, 0x40, 0x43, 0x40, 0x40, 0x41, 0x40, 0x40, 0x41, 0x40, 0x40, 0x5f, 0x5e,
+    0x5c, 0x5d, 0x5c, 0x40, 0x59, 0x58, 0x58, 0x5b, 0x5a, 0x58, 0x59, 0x58, 0x40, 0x41, 0x40, 0x40,
+    0x53, 0x50, 0x50, 0x51, 0x50, 0x50, 0x51, 0x50, 0x50, 0x57, 0x56, 0x54, 0x55, 0x54, 0x40, 0x51,
+    0x50, 0x50, 0x53, 0x52, 0x50, 0x51, 0x50, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x47, 0x40, 0x40, 0x41, 0x40, 0x00, 0x41, 0x40, 0x00, 0x43, 0x42, 0x40,
+    0x41, 0x40, 0x00, 0x41, 0x40, 0x40, 0x43, 0x40, 0x40, 0x41, 0x40, 0x40, 0x41, 0x40, 0x40, 0x4f,
+    0x4e, 0x4c, 0x4d, 0x4c, 0x40, 0x49, 0x48, 0x48, 0x4b, 0x4a, 0x48, 0x49, 0x48, 0x00, 0x01, 0x00,
+    0x00, 0x43, 0x40, 0x40, 0x41, 0x40, 0x40, 0x41, 0x40, 0x40, 0x47, 0x46, 0x44, 0x45, 0x44, 0x00,
+    0x41, 0x40, 0x40, 0x43, 0x42, 0x40, 0x41, 0x40, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x07, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00,
+    0x0f, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x02, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x07, 0x00, 0x00, 0x01, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x07, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00,
+    0x00, 0x1f, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x02, 0x00, 0x01, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x07, 0x06, 0x04, 0x05,
+    0x04, 0x00, 0x01, 0x00, 0x00, 0x03, 0x02, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x07, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00,
+    0x03, 0x02, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x0f, 0x0e, 0x0c, 0x0d, 0x0c, 0x00, 0x09, 0x08, 0x08, 0x0b, 0x0a, 0x08, 0x09, 0x08,
+    0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x07, 0x06, 0x04,
+    0x05, 0x04, 0x00, 0x01, 0x00, 0x00, 0x03, 0x02, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x07, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00,
+    0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x02, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x07, 0x06,
+    0x04, 0x05, 0x04, 0x00, 0x01, 0x00, 0x00, 0x03, 0x02, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00,
+    0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x07, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x03, 0x02, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x3f, 0x3e, 0x3c, 0x3d, 0x3c, 0x00, 0x39, 0x38, 0x38, 0x3b, 0x3a, 0x38,
+    0x39, 0x38, 0x00, 0x01, 0x00, 0x00, 0x33, 0x30, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x37,
+    0x36, 0x34, 0x35, 0x34, 0x00, 0x31, 0x30, 0x30, 0x33, 0x32, 0x30, 0x31, 0x30, 0x00, 0x01, 0x00,
+    0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x27, 0x20, 0x20, 0x21, 0x20, 0x00,
+    0x21, 0x20, 0x00, 0x23, 0x22, 0x20, 0x21, 0x20, 0x00, 0x21, 0x20, 0x20, 0x23, 0x20, 0x20, 0x21,
+    0x20, 0x20, 0x21, 0x20, 0x20, 0x2f, 0x2e, 0x2c, 0x2d, 0x2c, 0x20, 0x29, 0x28, 0x28, 0x2b, 0x2a,
+    0x28, 0x29, 0x28, 0x00, 0x01, 0x00, 0x00, 0x23, 0x20, 0x20, 0x21, 0x20, 0x20, 0x21, 0x20, 0x20,
+    0x27, 0x26, 0x24, 0x25, 0x24, 0x00, 0x21, 0x20, 0x20, 0x23, 0x22, 0x20, 0x21, 0x20, 0x00, 0x01,
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x07, 0x00, 0x00, 0x01, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03,
+    0x02, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00,
+    0x00, 0x07, 0x06, 0x04, 0x05, 0x04, 0x00, 0x01, 0x00, 0x00, 0x03, 0x02, 0x00, 0x01, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x07, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x02, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x1f, 0x1e, 0x1c, 0x1d, 0x1c, 0x00, 0x19, 0x18, 0x18,
+    0x1b, 0x1a, 0x18, 0x19, 0x18, 0x00, 0x01, 0x00, 0x00, 0x13, 0x10, 0x10, 0x11, 0x10, 0x10, 0x11,
+    0x10, 0x10, 0x17, 0x16, 0x14, 0x15, 0x14, 0x00, 0x11, 0x10, 0x10, 0x13, 0x12, 0x10, 0x11, 0x10,
+    0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x07, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x02, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x0f, 0x0e, 0x0c, 0x0d, 0x0c, 0x00, 0x09, 0x08,
+    0x08, 0x0b, 0x0a, 0x08, 0x09, 0x08, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x07, 0x06, 0x04, 0x05, 0x04, 0x00, 0x01, 0x00, 0x00, 0x03, 0x02, 0x00, 0x01,
+    0x00
+};
+
+#endif
@@ -0,0 +1,225 @@
+/************************************************************************
+ *
+ *  Transposition table: search results stored by position key, so positions
+ *  reached again through another move order, or searched again by the next
+ *  iteration, are not searched from scratch.
+ *
+ *  The table is a power-of-two array of 64-byte buckets, one cache line each,
+ *  indexed by the low bits of the key. A probe touches a single line, which
+ *  the search can prefetch as soon as it knows a child's key. The first
+ *  entries of a bucket keep the deepest results and the last one always takes
+ *  the newest, so deep results survive while shallow ones still get stored.
+ *  Entries from the searches of earlier moves are replaced first.
+ *
+ *  Each process has its own table, which lasts for the whole game.
+ *
+ ************************************************************************/
+#include <string.h>
+#include "othello.h"
+
+#define CACHE_LINE 64
+#define BUCKET_ENTRIES (CACHE_LINE / (int)sizeof(TTEntry))
+#define DEPTH_ENTRIES (BUCKET_ENTRIES - 1)
+
+typedef struct {
+    TTEntry entry[BUCKET_ENTRIES];
+} TTBucket;
+
+_Static_assert(sizeof(TTBucket) == CACHE_LINE, "a bucket must fill one cache line");
+
+TTBucket *transposition_table = NULL;
+size_t transposition_bytes = 0;
+uint64_t transposition_mask = 0;
+uint8_t transposition_age = 0;
+
+/**
+ * Allocates an empty transposition table of at most the given size. The
+ * number of buckets is rounded down to a power of two.
+ *
+ * @param megabytes size of the table in megabytes
+ * @return 1 if the table was allocated, 0 otherwise
+ */
+int init_transposition_table(size_t megabytes) {
+    size_t buckets = 1;
+
+    while (buckets * 2 * sizeof(TTBucket) <= megabytes << 20) {
+        buckets *= 2;
+    }
+
+    free_cache(transposition_table, transposition_bytes);
+    transposition_bytes = buckets * sizeof(TTBucket);
+    transposition_table = allocate_cache(transposition_bytes);
+    transposition_age = 0;
+
+    if (transposition_table == NULL) {
+        transposition_bytes = 0;
+        transposition_mask = 0;
+        return 0;
+    }
+
+    transposition_mask = buckets - 1;
+    return 1;
+}
+
+/**
+ * Returns the size of the transposition table.
+ *
+ * @return size of the table in bytes, 0 if there is none
+ */
+size_t transposition_table_size(void) {
+    return transposition_bytes;
+}
+
+/**
+ * Empties the transposition table.
+ */
+void clear_transposition_table(void) {
+    if (transposition_table != NULL) {
+        memset(transposition_table, 0, transposition_bytes);
+    }
+}
+
+/**
+ * Starts a new search generation. Entries stored before are still probed,
+ * but are the first to be replaced. Called once per move.
+ */
+void age_transposition_table(void) {
+    transposition_age++;
+}
+
+/**
+ * Starts loading the bucket of the given key into the cache, so a probe for
+ * it shortly afterwards does not wait on memory.
+ *
+ * @param key Zobrist key of a position about to be searched
+ */
+void prefetch_transposition(uint64_t key) {
+    if (transposition_table != NULL) {
+        __builtin_prefetch(&transposition_table[key & transposition_mask]);
+    }
+}
+
+/**
+ * Looks a position up in the transposition table.
+ *
+ * @param key Zobrist key of the position
+ * @return the entry for the position, or NULL if it is not stored
+ */
+TTEntry *probe_transposition(uint64_t key) {
+    TTBucket *bucket;
+
+    if (transposition_table == NULL) {
+        return NULL;
+    }
+
+    bucket = &transposition_table[key & transposition_mask];
+
+    for (int i = 0; i < BUCKET_ENTRIES; i++) {
+        TTEntry *entry = &bucket->entry[i];
+
+        if (entry->key == key && entry->bound != BOUND_NONE) {
+            return entry;
+        }
+    }
+
+    return NULL;
+}
+
+/**
+ * Stores a search result in the transposition table. A result for a position
+ * already in the bucket is merged with it when both come from the same
+ * depth, each bound keeping the tighter value, and otherwise replaces it,
+ * unless the stored one is from a deeper search and the new one is not
+ * exact. A new position takes the depth entry holding the oldest and then
+ * shallowest result, provided it is at least as deep, and the always-replace
+ * entry if not.
+ *
+ * @param key Zobrist key of the position
+ * @param depth depth the position was searched to
+ * @param bound whether the score is exact, a lower bound or an upper bound
+ * @param score score of the position for the side to move
+ * @param move best move found, or -1 if there is none
+ */
+void store_transposition(uint64_t key, int depth, int bound, int score, int move) {
+    TTBucket *bucket;
+    TTEntry *entry = NULL;
+
+    if (transposition_table == NULL) {
+        return;
+    }
+
+    bucket = &transposition_table[key & transposition_mask];
+
+    for (int i = 0; i < BUCKET_ENTRIES; i++) {
+        if (bucket->entry[i].key == key && bucket->entry[i].bound != BOUND_NONE) {
+            entry = &bucket->entry[i];
+            break;
+        }
+    }
+
+    if (entry != NULL) {
+        entry->age = transposition_age;
+
+        if (entry->depth > depth && bound != BOUND_EXACT) {
+            return;
+        }
+
+        if (entry->depth == depth) {
+            int lower = (bound & BOUND_LOWER) ? score : -TT_SCORE_MAX;
+            int upper = (bound & BOUND_UPPER) ? score : TT_SCORE_MAX;
+
+            if ((entry->bound & BOUND_LOWER) && entry->lower > lower) {
+                lower = entry->lower;
+            }
+            if ((entry->bound & BOUND_UPPER) && entry->upper < upper) {
+                upper = entry->upper;
+            }
+
+            /* bounds that cross come from an unstable search, keep the new */
+            if (lower <= upper) {
+                entry->lower = (int16_t)lower;
+                entry->upper = (int16_t)upper;
+                entry->bound |= (uint8_t)bound;
+
+                if (move >= 0 && (bound & BOUND_LOWER)) {
+                    entry->move = (int8_t)move;
+                }
+                return;
+            }
+        }
+    } else {
+        TTEntry *weakest = &bucket->entry[0];
+
+        for (int i = 1; i < DEPTH_ENTRIES; i++) {
+            TTEntry *candidate = &bucket->entry[i];
+            int candidate_current = candidate->bound != BOUND_NONE && candidate->age == transposition_age;
+            int weakest_current = weakest->bound != BOUND_NONE && weakest->age == transposition_age;
+
+            if (candidate_current < weakest_current ||
+                (candidate_current == weakest_current && candidate->depth < weakest->depth)) {
+                weakest = candidate;
+            }
+        }
+
+        if (weakest->bound == BOUND_NONE || weakest->age != transposition_age || depth >= weakest->depth) {
+            entry = weakest;
+        } else {
+            entry = &bucket->entry[BUCKET_ENTRIES - 1];
+        }
+
+        entry->move = -1;
+    }
+
+    entry->key = key;
+    entry->lower = (int16_t)((bound & BOUND_LOWER) ? score : -TT_SCORE_MAX);
+    entry->upper = (int16_t)((bound & BOUND_UPPER) ? score : TT_SCORE_MAX);
+    entry->depth = (int8_t)depth;
+    entry->bound = (uint8_t)bound;
+    entry->age = transposition_age;
+
+    /* the best move of a search that failed low is only a guess, so an
+       earlier move for the position is kept */
+    if (move >= 0 && ((bound & BOUND_LOWER) || entry->move < 0)) {
+        entry->move = (int8_t)move;
+    }
+}
@@ -0,0 +1,323 @@
+/************************************************************************
+ *
+ *  Builds an opening book from game records.
+ *
+ *  Usage: build_book [-p plies] [-m min_games] [-o book_file] [record_file...]
+ *
+ *  A record file holds one game per line, its moves as move strings ("rc",
+ *  the row and column counted from 1, see get_move_string) separated by
+ *  spaces, from the start position. Passes may be written as "pass" or left
+ *  out, and count as a ply either way. Blank lines and lines starting with
+ *  '#' are skipped, and without record files the records are read from the
+ *  standard input. Games that stop before neither side can move are
+ *  skipped too, as their disc difference is not a result.
+ *
+ *  Every position of the first plies of each game (20 by default) is scored
+ *  by how its moves did: the final disc difference of the record, for the
+ *  side that played the move, averaged over the games that played it. The
+ *  book keeps the move with the best average among those played in at least
+ *  min_games games (2 by default), so one-off blunders stay out. The book is
+ *  written to opening.book unless -o names another file.
+ *
+ ************************************************************************/
+#include "othello.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define LINE_SIZE 2048
+
+/* what read_record made of a record: a whole game, a game with an illegal
+   or unreadable move, or a game that stops before its end */
+#define RECORD_GAME 0
+#define RECORD_ILLEGAL 1
+#define RECORD_UNFINISHED 2
+
+/* a move played in a position, and the final disc difference for its player */
+typedef struct {
+    uint64_t key;
+    int move;
+    int score;
+} BookSample;
+
+BookSample *samples = NULL;
+size_t sample_count = 0;
+size_t sample_capacity = 0;
+
+int read_record(char *, int);
+int add_sample(uint64_t, int);
+int parse_move(const char *, int *);
+size_t choose_moves(BookEntry *, int);
+int compare_samples(const void *, const void *);
+
+int main(int argc, char *argv[]) {
+    const char *output = "opening.book";
+    char line[LINE_SIZE];
+    int plies = 20;
+    int min_games = 2;
+    int files = 0;
+    int games = 0;
+    int skipped = 0;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-p") == 0 && i + 1 < argc) {
+            plies = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "-m") == 0 && i + 1 < argc) {
+            min_games = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "-o") == 0 && i + 1 < argc) {
+            output = argv[++i];
+        } else if (argv[i][0] == '-') {
+            printf("Usage: %s [-p plies] [-m min_games] [-o book_file] [record_file...]\n", argv[0]);
+            return 1;
+        } else {
+            argv[++files] = argv[i];
+        }
+    }
+
+    if (plies < 1 || min_games < 1) {
+        printf("Plies and min_games must be at least 1\n");
+        return 1;
+    }
+
+    select_move_kernel();
+
+    /* the standard input stands in for a missing list of record files */
+    int sources = (files > 0) ? files : 1;
+
+    for (int f = 0; f < sources; f++) {
+        FILE *fp = (files == 0) ? stdin : fopen(argv[f + 1], "r");
+        int number = 0;
+
+        if (fp == NULL) {
+            printf("Could not open %s\n", argv[f + 1]);
+            return 1;
+        }
+
+        while (fgets(line, LINE_SIZE, fp) != NULL) {
+            number++;
+
+            /* blank lines may end in "\r\n" or hold spaces */
+            if (line[0] == '#' || line[strspn(line, " \t\r\n")] == '\0') {
+                continue;
+            }
+
+            int record = read_record(line, plies);
+
+            if (record == RECORD_GAME) {
+                games++;
+                continue;
+            }
+
+            printf("Skipping game on line %d of %s: %s\n", number,
+                   (files == 0) ? "the standard input" : argv[f + 1],
+                   (record == RECORD_ILLEGAL) ? "illegal or unreadable move" : "the game does not end");
+            skipped++;
+        }
+
+        if (fp != stdin) {
+            fclose(fp);
+        }
+    }
+
+    BookEntry *entries = malloc((sample_count + 1) * sizeof(BookEntry));
+
+    if (entries == NULL) {
+        printf("Out of memory\n");
+        return 1;
+    }
+
+    size_t count = choose_moves(entries, min_games);
+
+    if (!write_book(output, entries, count)) {
+        printf("Could not write %s\n", output);
+        return 1;
+    }
+
+    printf("%d games read, %d skipped, %zu positions written to %s\n", games, skipped, count, output);
+
+    free(entries);
+    free(samples);
+    return 0;
+}
+
+/**
+ * Replays one game record and adds a sample for each of its first plies.
+ * The samples of a game that cannot be replayed, or that stops while a side
+ * can still move, are taken back.
+ *
+ * @param line game record, modified by the parsing
+ * @param plies number of plies from the start to sample
+ * @return RECORD_GAME if the game was replayed to its end, RECORD_ILLEGAL if
+ *         it holds an illegal or unreadable move, RECORD_UNFINISHED if it
+ *         stops early
+ */
+int read_record(char *line, int plies) {
+    Position pos = start_position();
+    size_t first_sample = sample_count;
+    int black_to_move = 1;
+    int ply = 0;
+
+    for (char *token = strtok(line, " \t\r\n"); token != NULL; token = strtok(NULL, " \t\r\n")) {
+        Bitboard moves = get_moves(pos.player, pos.opponent);
+        int move;
+
+        if (!parse_move(token, &move)) {
+            sample_count = first_sample;
+            return RECORD_ILLEGAL;
+        }
+
+        /* a pass left out of the record, which counts as a ply as a written
+           one does */
+        if (moves == 0 && move >= 0 && get_moves(pos.opponent, pos.player) != 0) {
+            play_move(&pos, -1);
+            black_to_move = !black_to_move;
+            ply++;
+            moves = get_moves(pos.player, pos.opponent);
+        }
+
+        if (move >= 0 ? !(moves & SQUARE_BIT(move)) : moves != 0) {
+            sample_count = first_sample;
+            return RECORD_ILLEGAL;
+        }
+
+        if (move >= 0 && ply < plies) {
+            /* the score is filled in from the final position; the sign
+               records which side played */
+            if (!add_sample(hash_position(&pos).key, move)) {
+                printf("Out of memory\n");
+                exit(1);
+            }
+            samples[sample_count - 1].score = black_to_move ? 1 : -1;
+        }
+
+        play_move(&pos, move);
+        black_to_move = !black_to_move;
+        ply++;
+    }
+
+    /* only the final disc difference is a result */
+    if (get_moves(pos.player, pos.opponent) != 0 || get_moves(pos.opponent, pos.player) != 0) {
+        sample_count = first_sample;
+        return RECORD_UNFINISHED;
+    }
+
+    Bitboard black = black_to_move ? pos.player : pos.opponent;
+    Bitboard white = black_to_move ? pos.opponent : pos.player;
+    int black_score = count_discs(black) - count_discs(white);
+
+    for (size_t i = first_sample; i < sample_count; i++) {
+        samples[i].score *= black_score;
+    }
+
+    return RECORD_GAME;
+}
+
+/**
+ * Adds a sample, growing the sample array when it is full.
+ *
+ * @param key hash key of the position
+ * @param move move played in it
+ * @return 1 if the sample was added, 0 if out of memory
+ */
+int add_sample(uint64_t key, int move) {
+    if (sample_count == sample_capacity) {
+        size_t capacity = (sample_capacity > 0) ? sample_capacity * 2 : 4096;
+        BookSample *grown = realloc(samples, capacity * sizeof(BookSample));
+
+        if (grown == NULL) {
+            return 0;
+        }
+
+        samples = grown;
+        sample_capacity = capacity;
+    }
+
+    samples[sample_count].key = key;
+    samples[sample_count].move = move;
+    samples[sample_count].score = 0;
+    sample_count++;
+    return 1;
+}
+
+/**
+ * Reads a move string of a record.
+ *
+ * @param token move string: "rc" or "pass"
+ * @param move set to the square, or -1 for a pass
+ * @return 1 if the move string is valid, 0 if not
+ */
+int parse_move(const char *token, int *move) {
+    if (strcmp(token, "pass") == 0) {
+        *move = -1;
+        return 1;
+    }
+
+    if (strlen(token) != 2) {
+        return 0;
+    }
+
+    *move = get_loc(token);
+    return *move >= 0;
+}
+
+/**
+ * Picks the book move of every sampled position: the move with the best
+ * average score among those played often enough. Positions where no move
+ * was are left out.
+ *
+ * @param entries receives the book entries, room for one per sample
+ * @param min_games fewest games a move must have been played in
+ * @return number of entries
+ */
+size_t choose_moves(BookEntry *entries, int min_games) {
+    size_t count = 0;
+
+    qsort(samples, sample_count, sizeof(BookSample), compare_samples);
+
+    for (size_t i = 0; i < sample_count;) {
+        uint64_t key = samples[i].key;
+        BookEntry best = {key, 0, -1, 0, 0};
+
+        /* the samples of a position are together, grouped by move */
+        while (i < sample_count && samples[i].key == key) {
+            int move = samples[i].move;
+            long total = 0;
+            int games = 0;
+
+            for (; i < sample_count && samples[i].key == key && samples[i].move == move; i++) {
+                total += samples[i].score;
+                games++;
+            }
+
+            if (games >= min_games && (best.move < 0 || total / games > best.score)) {
+                best.move = (int8_t)move;
+                best.score = (int16_t)(total / games);
+                best.games = (uint32_t)games;
+            }
+        }
+
+        if (best.move >= 0) {
+            entries[count++] = best;
+        }
+    }
+
+    return count;
+}
+
+/**
+ * Orders samples by position key, then by move, for qsort.
+ *
+ * @param a first sample
+ * @param b second sample
+ * @return negative, zero or positive as a sorts before, with or after b
+ */
+int compare_samples(const void *a, const void *b) {
+    const BookSample *sample_a = a;
+    const BookSample *sample_b = b;
+
+    if (sample_a->key != sample_b->key) {
+        return (sample_a->key > sample_b->key) ? 1 : -1;
+    }
+
+    return sample_a->move - sample_b->move;
+}
@@ -0,0 +1,504 @@
+/************************************************************************
+ *
+ *  Perft: counts the leaf nodes of the game tree to a fixed depth, to
+ *  measure and validate move generation.
+ *
+ *  Usage: perft [-d depth] [-f position_file] [-x]
+ *
+ *  Without -f the tree is counted from the start position. A position file
+ *  holds one position per line: one character per square in row order, 'X'
+ *  for black, 'O' for white and '-' for empty, then a space and 'X' or 'O'
+ *  for the side to move. Blank lines and lines starting with '#' are skipped.
+ *
+ *  A pass counts as a move when only the side to move has to pass, and a
+ *  position where neither side can move is a leaf.
+ *
+ *  With -x every node is also checked against the reference move
+ *  generators in reference.c. The move lists and the board after every
+ *  move must agree, and the reference perft counts must match. The tool
+ *  exits with status 1 on the first disagreement.
+ *
+ ************************************************************************/
+#include "othello.h"
+#include "reference.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define MAX_DEPTH 32
+#define LINE_SIZE 256
+
+uint64_t perft(Position *, int);
+uint64_t reference_perft(int, int);
+uint64_t opponent_perft(int, int);
+uint64_t cross_check(Position *, int, int);
+void run_position(Position *, int, int, int);
+int read_position(char *, Position *, int *);
+void load_reference_boards(Position *, int);
+void check_reference_boards(Position *, int);
+void fail(const char *, Position *, int, int);
+void print_position(FILE *, Position *, int);
+double seconds_since(clock_t);
+
+int main(int argc, char *argv[]) {
+    int depth = 9;
+    int cross = 0;
+    char *file = NULL;
+    char line[LINE_SIZE];
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-d") == 0 && i + 1 < argc) {
+            depth = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "-f") == 0 && i + 1 < argc) {
+            file = argv[++i];
+        } else if (strcmp(argv[i], "-x") == 0) {
+            cross = 1;
+        } else {
+            printf("Usage: %s [-d depth] [-f position_file] [-x]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    if (depth < 1 || depth > MAX_DEPTH) {
+        printf("Depth must be between 1 and %d\n", MAX_DEPTH);
+        return 1;
+    }
+
+    select_move_kernel();
+    printf("Move kernel: %s\n", move_kernel_name);
+
+    if (file == NULL) {
+        Position pos = start_position();
+
+        run_position(&pos, REF_BLACK, depth, cross);
+        return 0;
+    }
+
+    FILE *fp = fopen(file, "r");
+
+    if (fp == NULL) {
+        printf("Could not open %s\n", file);
+        return 1;
+    }
+
+    int number = 0;
+
+    while (fgets(line, LINE_SIZE, fp) != NULL) {
+        Position pos;
+        int colour;
+
+        if (line[0] == '#' || line[0] == '\n') {
+            continue;
+        }
+
+        if (!read_position(line, &pos, &colour)) {
+            printf("Could not read position: %s", line);
+            fclose(fp);
+            return 1;
+        }
+
+        printf("\nPosition %d\n", ++number);
+        print_position(stdout, &pos, colour);
+        run_position(&pos, colour, depth, cross);
+    }
+
+    fclose(fp);
+    return 0;
+}
+
+/**
+ * Counts the leaves below a position for every depth up to the given one and
+ * prints the counts with the time taken and the nodes per second.
+ *
+ * @param pos position to count from, viewed from the side to move
+ * @param colour colour of the side to move, REF_BLACK or REF_WHITE
+ * @param depth deepest depth to count to
+ * @param cross whether to cross-check against the reference generators
+ */
+void run_position(Position *pos, int colour, int depth, int cross) {
+    printf("%5s %14s %10s %14s\n", "depth", "nodes", "seconds", "nodes/s");
+
+    for (int d = 1; d <= depth; d++) {
+        clock_t start = clock();
+        uint64_t nodes = perft(pos, d);
+        double seconds = seconds_since(start);
+
+        printf("%5d %14llu %10.3f %14.0f\n", d, (unsigned long long)nodes,
+               seconds, seconds > 0 ? nodes / seconds : 0.0);
+        fflush(stdout);
+
+        if (!cross) {
+            continue;
+        }
+
+        load_reference_boards(pos, colour);
+
+        start = clock();
+        uint64_t reference_nodes = reference_perft(colour, d);
+        double reference_seconds = seconds_since(start);
+
+        start = clock();
+        uint64_t opponent_nodes = opponent_perft(colour, d);
+        double opponent_seconds = seconds_since(start);
+
+        uint64_t checked_nodes = cross_check(pos, colour, d);
+
+        if (reference_nodes != nodes || opponent_nodes != nodes ||
+            checked_nodes != nodes) {
+            printf("Node counts differ at depth %d: library %llu, my_player %llu, "
+                   "local_opponent %llu, cross-check %llu\n",
+                   d, (unsigned long long)nodes,
+                   (unsigned long long)reference_nodes,
+                   (unsigned long long)opponent_nodes,
+                   (unsigned long long)checked_nodes);
+            exit(1);
+        }
+
+        printf("%5s %14s %10.3f %14.0f  my_player reference\n", "", "",
+               reference_seconds,
+               reference_seconds > 0 ? nodes / reference_seconds : 0.0);
+        printf("%5s %14s %10.3f %14.0f  local_opponent reference\n", "", "",
+               opponent_seconds,
+               opponent_seconds > 0 ? nodes / opponent_seconds : 0.0);
+    }
+}
+
+/**
+ * Counts the leaves below a position with the library move generation.
+ *
+ * @param pos position to count from, viewed from the side to move
+ * @param depth number of plies to search
+ * @return number of leaves
+ */
+uint64_t perft(Position *pos, int depth) {
+    Bitboard mobility = get_moves(pos->player, pos->opponent);
+    uint64_t nodes = 0;
+
+    if (mobility == 0) {
+        if (get_moves(pos->opponent, pos->player) == 0) {
+            return 1; // Game over
+        }
+
+        play_move(pos, -1);
+        nodes = depth == 1 ? 1 : perft(pos, depth - 1);
+        undo_move(pos, -1, 0);
+
+        return nodes;
+    }
+
+    if (depth == 1) {
+        return count_discs(mobility);
+    }
+
+    while (mobility) {
+        int move = first_square(mobility);
+        Bitboard flips = play_move(pos, move);
+
+        nodes += perft(pos, depth - 1);
+        undo_move(pos, move, flips);
+
+        mobility &= mobility - 1;
+    }
+
+    return nodes;
+}
+
+/**
+ * Counts the leaves below the position on the my_player.c reference board.
+ *
+ * @param colour colour of the side to move
+ * @param depth number of plies to search
+ * @return number of leaves
+ */
+uint64_t reference_perft(int colour, int depth) {
+    int moves[MAX_MOVES + 1];
+    int saved[BOARD_SQUARES];
+    int number_of_moves;
+    uint64_t nodes = 0;
+    int opp_colour = (colour == REF_WHITE) ? REF_BLACK : REF_WHITE;
+
+    if (depth == 0) {
+        return 1;
+    }
+
+    reference_legal_moves(moves, &number_of_moves, colour);
+
+    if (number_of_moves == 0) {
+        reference_legal_moves(moves, &number_of_moves, opp_colour);
+
+        if (number_of_moves == 0) {
+            return 1; // Game over
+        }
+
+        return reference_perft(opp_colour, depth - 1);
+    }
+
+    for (int i = 0; i < number_of_moves; i++) {
+        memcpy(saved, reference_board, sizeof(saved));
+
+        reference_make_move(moves[i], colour);
+        nodes += reference_perft(opp_colour, depth - 1);
+
+        memcpy(reference_board, saved, sizeof(saved));
+    }
+
+    return nodes;
+}
+
+/**
+ * Counts the leaves below the position on the local_opponent.c reference
+ * mailbox.
+ *
+ * @param colour colour of the side to move
+ * @param depth number of plies to search
+ * @return number of leaves
+ */
+uint64_t opponent_perft(int colour, int depth) {
+    int moves[MAX_MOVES + 1];
+    int saved[MAILBOX_SIZE];
+    uint64_t nodes = 0;
+    int opp_colour = (colour == REF_WHITE) ? REF_BLACK : REF_WHITE;
+
+    if (depth == 0) {
+        return 1;
+    }
+
+    opponent_legalmoves(colour, moves);
+
+    if (moves[0] == 0) {
+        opponent_legalmoves(opp_colour, moves);
+
+        if (moves[0] == 0) {
+            return 1; // Game over
+        }
+
+        return opponent_perft(opp_colour, depth - 1);
+    }
+
+    for (int i = 1; i <= moves[0]; i++) {
+        memcpy(saved, opponent_board, sizeof(saved));
+
+        opponent_makemove(moves[i], colour);
+        nodes += opponent_perft(opp_colour, depth - 1);
+
+        memcpy(opponent_board, saved, sizeof(saved));
+    }
+
+    return nodes;
+}
+
+/**
+ * Walks the tree with the library and both reference generators in step,
+ * checking that they agree on the move list at every node and on the board
+ * after every move.
+ *
+ * @param pos position to check from, viewed from the side to move
+ * @param colour colour of the side to move
+ * @param depth number of plies to search
+ * @return number of leaves
+ */
+uint64_t cross_check(Position *pos, int colour, int depth) {
+    int moves[MAX_MOVES + 1];
+    int reference_moves[MAX_MOVES + 1];
+    int opponent_moves[MAX_MOVES + 1];
+    int saved_board[BOARD_SQUARES];
+    int saved_mailbox[MAILBOX_SIZE];
+    int number_of_moves, reference_number;
+    uint64_t nodes = 0;
+    int opp_colour = (colour == REF_WHITE) ? REF_BLACK : REF_WHITE;
+
+    if (depth == 0) {
+        return 1;
+    }
+
+    number_of_moves = list_moves(get_moves(pos->player, pos->opponent), moves);
+    reference_legal_moves(reference_moves, &reference_number, colour);
+    opponent_legalmoves(colour, opponent_moves);
+
+    if (reference_number != number_of_moves ||
+        opponent_moves[0] != number_of_moves) {
+        fail("move counts differ", pos, colour, -1);
+    }
+
+    for (int i = 0; i < number_of_moves; i++) {
+        int m = moves[i];
+
+        if (reference_moves[i] != m ||
+            opponent_moves[i + 1] != MAILBOX_SQUARE(m)) {
+            fail("move lists differ", pos, colour, m);
+        }
+    }
+
+    if (number_of_moves == 0) {
+        if (get_moves(pos->opponent, pos->player) == 0) {
+            return 1; // Game over
+        }
+
+        play_move(pos, -1);
+        nodes = cross_check(pos, opp_colour, depth - 1);
+        undo_move(pos, -1, 0);
+
+        return nodes;
+    }
+
+    for (int i = 0; i < number_of_moves; i++) {
+        int m = moves[i];
+
+        memcpy(saved_board, reference_board, sizeof(saved_board));
+        memcpy(saved_mailbox, opponent_board, sizeof(saved_mailbox));
+
+        Bitboard flips = play_move(pos, m);
+        reference_make_move(m, colour);
+        opponent_makemove(MAILBOX_SQUARE(m), colour);
+
+        check_reference_boards(pos, opp_colour);
+        nodes += cross_check(pos, opp_colour, depth - 1);
+
+        undo_move(pos, m, flips);
+        memcpy(reference_board, saved_board, sizeof(saved_board));
+        memcpy(opponent_board, saved_mailbox, sizeof(saved_mailbox));
+    }
+
+    return nodes;
+}
+
+/**
+ * Sets both reference boards to the given position.
+ *
+ * @param pos position viewed from the side to move
+ * @param colour colour of the side to move
+ */
+void load_reference_boards(Position *pos, int colour) {
+    int opp_colour = (colour == REF_WHITE) ? REF_BLACK : REF_WHITE;
+
+    for (int i = 0; i < MAILBOX_SIZE; i++) {
+        opponent_board[i] = 3; // Outer
+    }
+
+    for (int sq = 0; sq < BOARD_SQUARES; sq++) {
+        int piece = REF_EMPTY;
+
+        if (pos->player & SQUARE_BIT(sq)) {
+            piece = colour;
+        } else if (pos->opponent & SQUARE_BIT(sq)) {
+            piece = opp_colour;
+        }
+
+        reference_board[sq] = piece;
+        opponent_board[MAILBOX_SQUARE(sq)] = piece;
+    }
+}
+
+/**
+ * Checks that both reference boards hold the given position.
+ *
+ * @param pos position viewed from the side to move
+ * @param colour colour of the side to move
+ */
+void check_reference_boards(Position *pos, int colour) {
+    int opp_colour = (colour == REF_WHITE) ? REF_BLACK : REF_WHITE;
+
+    for (int sq = 0; sq < BOARD_SQUARES; sq++) {
+        int piece = REF_EMPTY;
+
+        if (pos->player & SQUARE_BIT(sq)) {
+            piece = colour;
+        } else if (pos->opponent & SQUARE_BIT(sq)) {
+            piece = opp_colour;
+        }
+
+        if (reference_board[sq] != piece ||
+            opponent_board[MAILBOX_SQUARE(sq)] != piece) {
+            fail("boards differ after move", pos, colour, sq);
+        }
+    }
+}
+
+/**
+ * Reports a disagreement with the reference generators and exits.
+ *
+ * @param what description of the disagreement
+ * @param pos position it was found in
+ * @param colour colour of the side to move
+ * @param square square involved, or -1
+ */
+void fail(const char *what, Position *pos, int colour, int square) {
+    printf("Cross-check failed: %s (square %d)\n", what, square);
+    print_position(stdout, pos, colour);
+    exit(1);
+}
+
+/**
+ * Reads a position line of the form described at the top of this file.
+ *
+ * @param line line to read
+ * @param pos position to store, viewed from the side to move
+ * @param colour colour of the side to move
+ * @return 1 if the line held a position, 0 otherwise
+ */
+int read_position(char *line, Position *pos, int *colour) {
+    Bitboard black = 0, white = 0;
+
+    if (strlen(line) < BOARD_SQUARES + 2 || line[BOARD_SQUARES] != ' ') {
+        return 0;
+    }
+
+    for (int sq = 0; sq < BOARD_SQUARES; sq++) {
+        if (line[sq] == 'X') {
+            black |= SQUARE_BIT(sq);
+        } else if (line[sq] == 'O') {
+            white |= SQUARE_BIT(sq);
+        } else if (line[sq] != '-') {
+            return 0;
+        }
+    }
+
+    if (line[BOARD_SQUARES + 1] == 'X') {
+        *colour = REF_BLACK;
+        pos->player = black;
+        pos->opponent = white;
+    } else if (line[BOARD_SQUARES + 1] == 'O') {
+        *colour = REF_WHITE;
+        pos->player = white;
+        pos->opponent = black;
+    } else {
+        return 0;
+    }
+
+    return 1;
+}
+
+/**
+ * Prints a position in the position file format.
+ *
+ * @param fp file to print to
+ * @param pos position viewed from the side to move
+ * @param colour colour of the side to move
+ */
+void print_position(FILE *fp, Position *pos, int colour) {
+    char own = colour == REF_BLACK ? 'X' : 'O';
+    char other = colour == REF_BLACK ? 'O' : 'X';
+
+    for (int sq = 0; sq < BOARD_SQUARES; sq++) {
+        if (pos->player & SQUARE_BIT(sq)) {
+            fputc(own, fp);
+        } else if (pos->opponent & SQUARE_BIT(sq)) {
+            fputc(other, fp);
+        } else {
+            fputc('-', fp);
+        }
+    }
+
+    fprintf(fp, " %c\n", own);
+}
+
+/**
+ * Returns the processor time since the given clock reading, in seconds.
+ *
+ * @param start earlier clock reading
+ * @return elapsed seconds
+ */
+double seconds_since(clock_t start) {
+    return (double)(clock() - start) / CLOCKS_PER_SEC;
+}
@@ -0,0 +1,239 @@
+/************************************************************************
+ *
+ *  Reference move generators, see reference.h. The code is kept as it was
+ *  written apart from the board each function works on and the mailbox
+ *  width, which was fixed at 10.
+ *
+ ************************************************************************/
+#include "reference.h"
+
+#define EMPTY REF_EMPTY
+#define BLACK REF_BLACK
+#define WHITE REF_WHITE
+
+#define O_EMPTY REF_EMPTY
+#define O_BLACK REF_BLACK
+#define O_WHITE REF_WHITE
+#define O_OUTER 3
+
+int reference_board[BOARD_SQUARES];
+int opponent_board[MAILBOX_SIZE];
+
+#define O_FIRST (MAILBOX_WIDTH + 1)
+#define O_LAST (BOARD_SIZE * MAILBOX_WIDTH + BOARD_SIZE)
+
+static const int O_ALLDIRECTIONS[8] = {-MAILBOX_WIDTH - 1, -MAILBOX_WIDTH, -MAILBOX_WIDTH + 1, -1,
+                                       1, MAILBOX_WIDTH - 1, MAILBOX_WIDTH, MAILBOX_WIDTH + 1};
+
+void flip_direction(int, int, int, int, int);
+int check_direction(int, int, int, int, int, int);
+
+int opponent_legalp(int, int);
+int opponent_validp(int);
+int opponent_wouldflip(int, int, int);
+int opponent_opponent(int);
+int opponent_findbracketingpiece(int, int, int);
+void opponent_makeflips(int, int, int);
+
+/*
+ * my_player.c
+ */
+
+void flip_direction(int x, int y, int dx, int dy, int my_colour) {
+    int i = x + dx;
+    int j = y + dy;
+
+    // Move along the direction and flip pieces until we hit a piece of
+    // my_colour
+    while (i >= 0 && i < BOARD_SIZE && j >= 0 && j < BOARD_SIZE &&
+           reference_board[i * BOARD_SIZE + j] != my_colour) {
+        reference_board[i * BOARD_SIZE + j] = my_colour;
+        i += dx;
+        j += dy;
+    }
+}
+
+/**
+ * Applies the given move to the board.
+ *
+ * @param move move to apply
+ * @param my_colour colour of the player
+ */
+void reference_make_move(int move, int colour) {
+    int row = move / BOARD_SIZE;
+    int col = move % BOARD_SIZE;
+    int opp_colour = (colour == WHITE) ? BLACK : WHITE;
+    reference_board[row * BOARD_SIZE + col] = colour;
+
+    // Check and flip in all 8 directions
+    for (int dx = -1; dx <= 1; dx++) {
+        for (int dy = -1; dy <= 1; dy++) {
+            if (dx == 0 && dy == 0)
+                continue; // Skip the current cell
+
+            int i = row + dx;
+            int j = col + dy;
+            int found_opp = 0;
+
+            // Move in the direction and check for opponent's pieces followed by
+            // my piece
+            while (i >= 0 && i < BOARD_SIZE && j >= 0 && j < BOARD_SIZE) {
+                if (reference_board[i * BOARD_SIZE + j] == opp_colour) {
+                    found_opp = 1;
+                    i += dx;
+                    j += dy;
+                } else if (reference_board[i * BOARD_SIZE + j] == colour && found_opp) {
+                    flip_direction(row, col, dx, dy, colour);
+                    break; // Stop checking this direction as we've found a
+                           // valid line
+                } else {
+                    break; // No valid line in this direction
+                }
+            }
+        }
+    }
+}
+
+/**
+ * Checks if the given direction is valid. A direction is valid if it sandwiches
+ * at least one of the opponent's pieces between the piece being placed and
+ * another piece of the player's colour.
+ *
+ * @param x x-coordinate of the piece being placed
+ * @param y y-coordinate of the piece being placed
+ * @param dx x-direction to check
+ * @param dy y-direction to check
+ * @param my_colour colour of the player
+ * @param opp_colour colour of the opponent
+ * @return 1 if the direction is valid, 0 otherwise
+ */
+int check_direction(int x, int y, int dx, int dy, int my_colour,
+                    int opp_colour) {
+    int i = x + dx;
+    int j = y + dy;
+    int found_opp = 0; // Flag to check if at least one opponent piece is found
+
+    while (i >= 0 && i < BOARD_SIZE && j >= 0 && j < BOARD_SIZE) {
+        if (reference_board[i * BOARD_SIZE + j] == opp_colour) {
+            found_opp = 1;
+            i += dx;
+            j += dy;
+        } else if (reference_board[i * BOARD_SIZE + j] == my_colour && found_opp) {
+            return 1; // Valid direction as it sandwiches opponent's pieces
+        } else {
+            return 0; // Either empty or own piece without sandwiching
+                      // opponent's pieces
+        }
+    }
+    return 0;
+}
+
+/**
+ * Gets a list of legal moves for the current board, and stores them in the
+ * moves array followed by a -1. Also stores the number of legal moves in the
+ * number_of_moves variable.
+ *
+ * @param moves array to store the legal moves in
+ * @param number_of_moves variable to store the number of legal moves in
+ */
+void reference_legal_moves(int *moves, int *number_of_moves, int my_colour) {
+    int opp_colour = (my_colour == WHITE) ? BLACK : WHITE;
+    *number_of_moves = 0;
+
+    for (int i = 0; i < BOARD_SIZE; i++) {
+        for (int j = 0; j < BOARD_SIZE; j++) {
+            if (reference_board[i * BOARD_SIZE + j] != EMPTY)
+                continue;
+
+            int moveFound =
+                0; // Flag to indicate if a legal move is found for the cell
+
+            // Check all 8 directions from the current cell
+            for (int dx = -1; dx <= 1 && !moveFound; dx++) {
+                for (int dy = -1; dy <= 1 && !moveFound; dy++) {
+                    if (dx == 0 && dy == 0)
+                        continue; // Skip checking the current cell
+
+                    if (check_direction(i, j, dx, dy, my_colour, opp_colour)) {
+                        moves[(*number_of_moves)++] = i * BOARD_SIZE + j;
+                        moveFound = 1; // A legal move is found, no need to
+                                       // check other directions
+                    }
+                }
+            }
+        }
+    }
+
+    moves[*number_of_moves] = -1; // End of moves
+}
+
+/*
+ * local_opponent.c
+ */
+
+void opponent_legalmoves (int player, int *moves) {
+    int move, i;
+    moves[0] = 0;
+    i = 0;
+    for (move=O_FIRST; move<=O_LAST; move++)
+        if (opponent_legalp(move, player)) {
+            i++;
+            moves[i]=move;
+        }
+    moves[0]=i;
+}
+
+int opponent_legalp (int move, int player) {
+    int i;
+    if (!opponent_validp(move)) return 0;
+    if (opponent_board[move]==O_EMPTY) {
+        i=0;
+        while (i<=7 && !opponent_wouldflip(move, O_ALLDIRECTIONS[i], player)) i++;
+        if (i==8) return 0; else return 1;
+    }
+    else return 0;
+}
+
+int opponent_validp (int move) {
+    if ((move >= O_FIRST) && (move <= O_LAST) && (move%MAILBOX_WIDTH >= 1) && (move%MAILBOX_WIDTH <= BOARD_SIZE))
+        return 1;
+    else return 0;
+}
+
+int opponent_wouldflip (int move, int dir, int player) {
+    int c;
+    c = move + dir;
+    if (opponent_board[c] == opponent_opponent(player))
+        return opponent_findbracketingpiece(c+dir, dir, player);
+    else return 0;
+}
+
+int opponent_findbracketingpiece(int square, int dir, int player) {
+    while (opponent_board[square] == opponent_opponent(player)) square = square + dir;
+    if (opponent_board[square] == player) return square;
+    else return 0;
+}
+
+int opponent_opponent (int player) {
+    if (player == O_WHITE) return O_BLACK;
+    if (player == O_BLACK) return O_WHITE;
+    return O_EMPTY;
+}
+
+void opponent_makemove (int move, int player) {
+    int i;
+    opponent_board[move] = player;
+    for (i=0; i<=7; i++) opponent_makeflips(move, O_ALLDIRECTIONS[i], player);
+}
+
+void opponent_makeflips (int move, int dir, int player) {
+    int bracketer, c;
+    bracketer = opponent_wouldflip(move, dir, player);
+    if (bracketer) {
+        c = move + dir;
+        do {
+            opponent_board[c] = player;
+            c = c + dir;
+        } while (c != bracketer);
+    }
+}
@@ -0,0 +1,41 @@
+#ifndef REFERENCE_H
+#define REFERENCE_H
+
+/************************************************************************
+ *
+ *  Reference move generators kept for validating the library: the int
+ *  array legal_moves/make_move from my_player.c and the 10x10 mailbox
+ *  opponent_legalmoves/opponent_makemove from the local referee's
+ *  local_opponent.c, as they were before both moved onto othello_core.
+ *
+ *  Each works on its own global board. Colours are REF_EMPTY, REF_BLACK
+ *  and REF_WHITE on both boards. Both follow BOARD_SIZE from othello.h, the
+ *  mailbox being the board with a one square border all round.
+ *
+ ************************************************************************/
+#include "othello.h"
+
+#define REF_EMPTY 0
+#define REF_BLACK 1
+#define REF_WHITE 2
+
+#define MAILBOX_WIDTH (BOARD_SIZE + 2)
+#define MAILBOX_SIZE (MAILBOX_WIDTH * MAILBOX_WIDTH)
+
+/* mailbox square of a board square */
+#define MAILBOX_SQUARE(square) \
+    (((square) / BOARD_SIZE + 1) * MAILBOX_WIDTH + (square) % BOARD_SIZE + 1)
+
+/* board of the my_player.c reference, square = row * BOARD_SIZE + col */
+extern int reference_board[BOARD_SQUARES];
+
+/* mailbox of the local_opponent.c reference, see MAILBOX_SQUARE */
+extern int opponent_board[MAILBOX_SIZE];
+
+void reference_legal_moves(int *, int *, int);
+void reference_make_move(int, int);
+
+void opponent_legalmoves(int, int *);
+void opponent_makemove(int, int);
+
+#endif
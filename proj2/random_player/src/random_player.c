@@ -34,6 +34,7 @@
  *
  ************************************************************************/
 #include "comms.h"
+#include "othello.h"
 #include <arpa/inet.h>
 #include <mpi.h>
 #include <stdbool.h>
@@ -42,20 +43,16 @@
 #include <string.h>
 #include <time.h>
 
-#define BOARD_SIZE 8
 #define EMPTY -1
 #define BLACK 0
 #define WHITE 1
 
-#define MAX_MOVES 64
-
 const char *PLAYER_NAME_LOG = "random_player.log";
 
 void run_master(int, char *[]);
 int initialise_master(int, char *[], int *, int *, FILE **);
 
 void initialise_board(void);
-void free_board(void);
 void print_board(FILE *);
 void reset_board(FILE *);
 
@@ -63,11 +60,10 @@ void run_worker(int);
 
 int random_strategy(int, FILE *);
 void legal_moves(int *, int *, int);
-int check_direction(int, int, int, int, int, int);
 void make_move(int, int);
-void flip_direction(int, int, int, int, int);
 
-int *board;
+/* game board, with BLACK's discs in player and WHITE's discs in opponent */
+Position board;
 
 int main(int argc, char *argv[]) {
     int rank;
@@ -81,6 +77,9 @@ int main(int argc, char *argv[]) {
     MPI_Init(&argc, &argv);
     MPI_Comm_rank(MPI_COMM_WORLD, &rank);
 
+    /* each process picks the fastest mobility kernel its CPU supports */
+    select_move_kernel();
+
     /* each process initialises their own board */
     initialise_board();
 
@@ -90,8 +89,6 @@ int main(int argc, char *argv[]) {
         run_worker(rank);
     }
 
-    free_board();
-
     MPI_Finalize();
     return 0;
 }
@@ -189,14 +186,8 @@ void run_worker(int rank) {
  */
 void reset_board(FILE *fp) {
 
-    int mid = BOARD_SIZE / 2;
-    memset(board, EMPTY, sizeof(int) * BOARD_SIZE * BOARD_SIZE);
-
     // Set up the initial four pieces in the middle
-    board[mid * BOARD_SIZE + mid] = WHITE;
-    board[(mid - 1) * BOARD_SIZE + (mid - 1)] = WHITE;
-    board[mid * BOARD_SIZE + (mid - 1)] = BLACK;
-    board[(mid - 1) * BOARD_SIZE + mid] = BLACK;
+    board = start_position();
 
     fprintf(fp, "~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\n");
     fprintf(fp, "~~~~~~~~~~~~~ NEW MATCH ~~~~~~~~~~~~\n");
@@ -235,20 +226,6 @@ int random_strategy(int my_colour, FILE *fp) {
     return move;
 }
 
-void flip_direction(int x, int y, int dx, int dy, int my_colour) {
-    int i = x + dx;
-    int j = y + dy;
-
-    // Move along the direction and flip pieces until we hit a piece of
-    // my_colour
-    while (i >= 0 && i < BOARD_SIZE && j >= 0 && j < BOARD_SIZE &&
-           board[i * BOARD_SIZE + j] != my_colour) {
-        board[i * BOARD_SIZE + j] = my_colour;
-        i += dx;
-        j += dy;
-    }
-}
-
 /**
  * Applies the given move to the board.
  *
@@ -256,72 +233,12 @@ void flip_direction(int x, int y, int dx, int dy, int my_colour) {
  * @param my_colour colour of the player
  */
 void make_move(int move, int colour) {
-    int row = move / BOARD_SIZE;
-    int col = move % BOARD_SIZE;
-    int opp_colour = (colour == WHITE) ? BLACK : WHITE;
-    board[row * BOARD_SIZE + col] = colour;
-
-    // Check and flip in all 8 directions
-    for (int dx = -1; dx <= 1; dx++) {
-        for (int dy = -1; dy <= 1; dy++) {
-            if (dx == 0 && dy == 0)
-                continue; // Skip the current cell
-
-            int i = row + dx;
-            int j = col + dy;
-            int found_opp = 0;
-
-            // Move in the direction and check for opponent's pieces followed by
-            // my piece
-            while (i >= 0 && i < BOARD_SIZE && j >= 0 && j < BOARD_SIZE) {
-                if (board[i * BOARD_SIZE + j] == opp_colour) {
-                    found_opp = 1;
-                    i += dx;
-                    j += dy;
-                } else if (board[i * BOARD_SIZE + j] == colour && found_opp) {
-                    flip_direction(row, col, dx, dy, colour);
-                    break; // Stop checking this direction as we've found a
-                           // valid line
-                } else {
-                    break; // No valid line in this direction
-                }
-            }
-        }
-    }
-}
+    Bitboard *mine = (colour == BLACK) ? &board.player : &board.opponent;
+    Bitboard *theirs = (colour == BLACK) ? &board.opponent : &board.player;
+    Bitboard flips = get_flips(*mine, *theirs, move);
 
-/**
- * Checks if the given direction is valid. A direction is valid if it sandwiches
- * at least one of the opponent's pieces between the piece being placed and
- * another piece of the player's colour.
- *
- * @param x x-coordinate of the piece being placed
- * @param y y-coordinate of the piece being placed
- * @param dx x-direction to check
- * @param dy y-direction to check
- * @param my_colour colour of the player
- * @param opp_colour colour of the opponent
- * @return 1 if the direction is valid, 0 otherwise
- */
-int check_direction(int x, int y, int dx, int dy, int my_colour,
-                    int opp_colour) {
-    int i = x + dx;
-    int j = y + dy;
-    int found_opp = 0; // Flag to check if at least one opponent piece is found
-
-    while (i >= 0 && i < BOARD_SIZE && j >= 0 && j < BOARD_SIZE) {
-        if (board[i * BOARD_SIZE + j] == opp_colour) {
-            found_opp = 1;
-            i += dx;
-            j += dy;
-        } else if (board[i * BOARD_SIZE + j] == my_colour && found_opp) {
-            return 1; // Valid direction as it sandwiches opponent's pieces
-        } else {
-            return 0; // Either empty or own piece without sandwiching
-                      // opponent's pieces
-        }
-    }
-    return 0;
+    *mine |= flips | SQUARE_BIT(move);
+    *theirs ^= flips;
 }
 
 /**
@@ -338,50 +255,19 @@ int check_direction(int x, int y, int dx, int dy, int my_colour,
  * @param number_of_moves variable to store the number of legal moves in
  */
 void legal_moves(int *moves, int *number_of_moves, int my_colour) {
-    int opp_colour = (my_colour == WHITE) ? BLACK : WHITE;
-    *number_of_moves = 0;
-
-    for (int i = 0; i < BOARD_SIZE; i++) {
-        for (int j = 0; j < BOARD_SIZE; j++) {
-            if (board[i * BOARD_SIZE + j] != EMPTY)
-                continue;
-
-            int moveFound =
-                0; // Flag to indicate if a legal move is found for the cell
-
-            // Check all 8 directions from the current cell
-            for (int dx = -1; dx <= 1 && !moveFound; dx++) {
-                for (int dy = -1; dy <= 1 && !moveFound; dy++) {
-                    if (dx == 0 && dy == 0)
-                        continue; // Skip checking the current cell
-
-                    if (check_direction(i, j, dx, dy, my_colour, opp_colour)) {
-                        moves[(*number_of_moves)++] = i * BOARD_SIZE + j;
-                        moveFound = 1; // A legal move is found, no need to
-                                       // check other directions
-                    }
-                }
-            }
-        }
-    }
+    Bitboard mobility = (my_colour == BLACK)
+                            ? get_moves(board.player, board.opponent)
+                            : get_moves(board.opponent, board.player);
 
-    moves[*number_of_moves] = -1; // End of moves
+    *number_of_moves = list_moves(mobility, moves);
 }
 
 /**
  * Initialises the board for the game.
  */
 void initialise_board(void) {
-    int mid = BOARD_SIZE / 2;
-
-    board = malloc(sizeof(int) * BOARD_SIZE * BOARD_SIZE);
-    memset(board, EMPTY, sizeof(int) * BOARD_SIZE * BOARD_SIZE);
-
     /* plave initial pieces */
-    board[mid * BOARD_SIZE + mid] = WHITE;
-    board[(mid - 1) * BOARD_SIZE + (mid - 1)] = WHITE;
-    board[mid * BOARD_SIZE + (mid - 1)] = BLACK;
-    board[(mid - 1) * BOARD_SIZE + mid] = BLACK;
+    board = start_position();
 }
 
 /**
@@ -403,23 +289,20 @@ void print_board(FILE *fp) {
     for (int i = 0; i < BOARD_SIZE; ++i) {
         fprintf(fp, "%d ", i); // Print row numbers
         for (int j = 0; j < BOARD_SIZE; ++j) {
-            if (board[i * BOARD_SIZE + j] == EMPTY) {
-                fprintf(fp, ". "); // Print a dot for empty spaces
-            } else if (board[i * BOARD_SIZE + j] == BLACK) {
+            Bitboard square = SQUARE_BIT(i * BOARD_SIZE + j);
+
+            if (board.player & square) {
                 fprintf(fp, "B "); // Print B for Black pieces
-            } else if (board[i * BOARD_SIZE + j] == WHITE) {
+            } else if (board.opponent & square) {
                 fprintf(fp, "W "); // Print W for White pieces
+            } else {
+                fprintf(fp, ". "); // Print a dot for empty spaces
             }
         }
         fprintf(fp, "\n");
     }
 }
 
-/**
- * Frees the memory allocated for the board.
- */
-void free_board(void) { free(board); }
-
 /**
  * Initialises the master process for communication with the IF wrapper and set
  * up the log file.
@@ -113,13 +113,22 @@ def compile_and_move_players():
     Looks for directories ending in "_player" and compiles them.
     """
     compiler = "mpicc"
-    cflags = "-O2 -g -Wall -Wno-variadic-macros -pedantic -DDEBUG"
+    cflags = "-O2 -g -Wall -Wno-variadic-macros -pedantic -DDEBUG -Iothello_core/src"
     ldflags = "-g"
-    ldlibs = ""
+    ldlibs = "othello_core/lib/libothello.a"
     new_dir = "players"
 
     os.makedirs("players", exist_ok=True)
 
+    # Build the shared Othello core library that every player links against
+    globals.logger.info("Building 'othello_core'")
+    result = subprocess.run("make -C othello_core", shell=True, stdout=subprocess.PIPE, stderr=subprocess.PIPE, text=True)
+
+    if result.returncode != 0:
+        print(result.stderr)
+        globals.logger.error("Compilation failed for `othello_core`. Exiting now.")
+        return False
+
     # Get all directory names ending in "_player"
     player_names = [name for name in os.listdir() if name.endswith("_player")]
 
@@ -131,7 +140,7 @@ def compile_and_move_players():
 
         # Compile the player
         globals.logger.info(f"Compiling '{player}'")
-        compile_command = f"{compiler} {cflags} {ldflags} {ldlibs} -o {executable_file} {player_source_file} {comms_source}"
+        compile_command = f"{compiler} {cflags} {ldflags} -o {executable_file} {player_source_file} {comms_source} {ldlibs}"
 
         # Execute the command and capture stdout and stderr
         result = subprocess.run(compile_command, shell=True, stdout=subprocess.PIPE, stderr=subprocess.PIPE, text=True)
@@ -0,0 +1,53 @@
+/********************************************************************
+ *
+ * Stands in for the player's comms.c when it is built against the local
+ * referee. The player's comms API is mapped onto the referee commands, and
+ * moves are converted between the player's square numbers and the
+ * referee's "rc" move strings.
+ *
+ */
+
+#include "comms.h"
+#include "othello.h"
+#include "referee.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+int initialise_comms(unsigned long int ip, int port) {
+    int colour;
+
+    return comms_init_network(&colour, ip, port) == SUCCESS;
+}
+
+int receive_message(int *move) {
+    char cmd[CMDBUFSIZE];
+    char move_string[MOVEBUFSIZE];
+
+    memset(move_string, 0, sizeof(move_string));
+
+    if (comms_get_cmd(cmd, move_string) != SUCCESS) {
+        return RECV_FAILED;
+    }
+
+    if (strcmp(cmd, "gen_move") == 0) {
+        return GENERATE_MOVE;
+    } else if (strcmp(cmd, "play_move") == 0) {
+        *move = get_loc(move_string);
+        return PLAY_MOVE;
+    } else if (strcmp(cmd, "game_over") == 0) {
+        return GAME_TERMINATION;
+    }
+
+    return UNKNOWN;
+}
+
+int send_move(char *move) {
+    char move_string[MOVEBUFSIZE];
+
+    get_move_string(atoi(move), move_string);
+
+    return comms_send_move(move_string) == SUCCESS ? 0 : -1;
+}
+
+void close_comms(void) {}
@@ -1,7 +1,7 @@
 #include <stdio.h>
 #include <string.h>
 #include "local_opponent.h"
-#include "comms.h"
+#include "referee.h"
 
 const int BL_PL = 1;
 const int WH_PL = 2;
@@ -18,6 +18,7 @@ int comms_init_network(int* my_colour, unsigned long ip, int port) {
     } else {
 	*my_colour = WH_PL;
         opponent_initialise(BL_PL);
+        status = WH_PL; /* black opens, so the opponent moves first */
 	printf("Player colour = white\nOpponent colour = black\n");
     }
     return SUCCESS;
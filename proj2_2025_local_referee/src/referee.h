@@ -1,5 +1,5 @@
-#ifndef _COMMS_H
-#define _COMMS_H
+#ifndef _REFEREE_H
+#define _REFEREE_H
 
 #define FAILURE -1
 #define SUCCESS 1